@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <blake2s/blake2s.h>
+#include <monocypher/monocypher-ed25519.h>
+#include <monocypher/monocypher.h>
+#include <stdint.h>
+#include <tkey/assert.h>
+#include <tkey/io.h>
+#include <tkey/led.h>
+#include <tkey/lib.h>
+#include <tkey/perf.h>
+
+#define BUFSIZE 256
+#define DATASIZE 1024
+
+// One extra word so the data can be hashed from an unaligned address
+static uint32_t data[DATASIZE / 4 + 1];
+static uint32_t data2[DATASIZE / 4 + 1];
+
+static uint32_t start;
+
+void cycles_start(void)
+{
+	start = perf_cycles();
+}
+
+// Clock cycles since cycles_start()
+uint32_t cycles(void)
+{
+	return perf_cycles() - start;
+}
+
+void report(const char *what, uint32_t n)
+{
+	puts(IO_CDC, what);
+	putinthex(IO_CDC, n);
+	puts(IO_CDC, "\r\n");
+}
+
+// Clock cycles for hashing len bytes starting offset bytes into the
+// data buffer.
+uint32_t blake2s_cycles(uint32_t offset, uint32_t len)
+{
+	uint8_t digest[32];
+
+	cycles_start();
+	blake2s(digest, sizeof(digest), NULL, 0, (uint8_t *)data + offset,
+		len);
+
+	return cycles();
+}
+
+void blake2s_bench(void)
+{
+	for (int i = 0; i < sizeof(data); i++) {
+		((uint8_t *)data)[i] = i;
+	}
+
+	report("blake2s 64 bytes, aligned: ", blake2s_cycles(0, 64));
+	report("blake2s 64 bytes, unaligned: ", blake2s_cycles(1, 64));
+	report("blake2s 1024 bytes, aligned: ", blake2s_cycles(0, DATASIZE));
+	report("blake2s 1024 bytes, unaligned: ",
+	       blake2s_cycles(1, DATASIZE));
+}
+
+// Keep the compiler from dropping or merging memory accesses to the
+// buffers between measurements.
+static void barrier(void)
+{
+	asm volatile("" : : : "memory");
+}
+
+// Results of memeq(), so the calls aren't optimized away.
+static volatile int memeq_res;
+
+// Clock cycles per KiB for the memory functions in libcommon.
+void lib_bench(void)
+{
+	uint8_t *src = (uint8_t *)data;
+	uint8_t *dst = (uint8_t *)data2;
+
+	cycles_start();
+	memcpy(dst, src, DATASIZE);
+	barrier();
+	report("memcpy 1024 bytes, aligned: ", cycles());
+
+	cycles_start();
+	memcpy(dst + 1, src + 1, DATASIZE);
+	barrier();
+	report("memcpy 1024 bytes, both unaligned: ", cycles());
+
+	cycles_start();
+	memcpy(dst, src + 1, DATASIZE);
+	barrier();
+	report("memcpy 1024 bytes, different alignment: ", cycles());
+
+	cycles_start();
+	wordcpy(dst, src, DATASIZE / 4);
+	barrier();
+	report("wordcpy 1024 bytes: ", cycles());
+
+	cycles_start();
+	memset(dst, 0x5a, DATASIZE);
+	barrier();
+	report("memset 1024 bytes: ", cycles());
+
+	cycles_start();
+	secure_wipe(dst, DATASIZE);
+	barrier();
+	report("secure_wipe 1024 bytes: ", cycles());
+
+	memcpy(dst, src, DATASIZE);
+	barrier();
+	cycles_start();
+	memeq_res = memeq(dst, src, DATASIZE);
+	report("memeq 1024 bytes, equal: ", cycles());
+
+	dst[0] ^= 1;
+	barrier();
+	cycles_start();
+	memeq_res = memeq(dst, src, DATASIZE);
+	report("memeq 1024 bytes, first byte differs: ", cycles());
+}
+
+// Clock cycles for hashing len bytes of the data buffer with SHA-512.
+uint32_t sha512_cycles(uint32_t len)
+{
+	uint8_t digest[64];
+
+	cycles_start();
+	crypto_sha512(digest, (uint8_t *)data, len);
+
+	return cycles();
+}
+
+// Clock cycles for deriving an Ed25519 key pair from a seed. Most of
+// it is the fixed-base scalar multiplication, which gets faster with
+// more comb tables, see MONOCYPHER_COMB_TABLES in tkey-libs.
+uint32_t ed25519_key_pair_cycles(void)
+{
+	uint8_t seed[32] = {0};
+	uint8_t secret_key[64];
+	uint8_t public_key[32];
+
+	cycles_start();
+	crypto_ed25519_key_pair(secret_key, public_key, seed);
+
+	return cycles();
+}
+
+// Clock cycles for signing len bytes of the data buffer with Ed25519.
+uint32_t ed25519_sign_cycles(uint32_t len)
+{
+	uint8_t seed[32] = {0};
+	uint8_t secret_key[64];
+	uint8_t public_key[32];
+	uint8_t signature[64];
+
+	crypto_ed25519_key_pair(secret_key, public_key, seed);
+
+	cycles_start();
+	crypto_ed25519_sign(signature, secret_key, (uint8_t *)data, len);
+
+	return cycles();
+}
+
+// Clock cycles for an X25519 key exchange, computing the shared
+// secret from our secret key and their public key.
+uint32_t x25519_cycles(void)
+{
+	uint8_t secret_key[32] = {1};
+	uint8_t their_public_key[32] = {9};
+	uint8_t shared_secret[32];
+
+	cycles_start();
+	crypto_x25519(shared_secret, secret_key, their_public_key);
+
+	return cycles();
+}
+
+// SHA-512 uses the SHA-512 core if the bitstream includes it, and
+// field multiplication the FE25519 core if tkey-libs is built with
+// MONOCYPHER_FE25519=1. Run on bitstreams with and without them to
+// compare.
+void ed25519_bench(void)
+{
+	report("sha512 1024 bytes: ", sha512_cycles(DATASIZE));
+	report("ed25519 key pair: ", ed25519_key_pair_cycles());
+	report("ed25519 sign 64 bytes: ", ed25519_sign_cycles(64));
+	report("x25519: ", x25519_cycles());
+}
+
+int main(void)
+{
+	uint8_t available = 0;
+	uint8_t cmdbuf[BUFSIZE] = {0};
+	enum ioend endpoint = IO_NONE;
+
+	led_set(LED_BLUE);
+
+	config_endpoints(IO_CDC | IO_DEBUG);
+
+	while (1) {
+		// Run the benchmarks on any input on the CDC endpoint
+		if (readselect(IO_CDC, &endpoint, &available) != 0) {
+			assert(1 == 2);
+		}
+
+		if (read(IO_CDC, cmdbuf, BUFSIZE, available) < 0) {
+			assert(1 == 2);
+		}
+
+		led_set(LED_GREEN);
+		blake2s_bench();
+		lib_bench();
+		ed25519_bench();
+		led_set(LED_BLUE);
+	}
+}
@@ -7,6 +7,7 @@
 #include <tkey/io.h>
 #include <tkey/led.h>
 #include <tkey/lib.h>
+#include <tkey/tk1_mem.h>
 
 #define BUFSIZE 256
 #define HEADER_SIZE 2
@@ -14,12 +15,97 @@
 #define MAX_PAYLOAD_SIZE 64
 #define SLEEPTIME 100000
 
+// Sending this on the CDC endpoint runs the transmit benchmark
+#define BENCH_CMD "txbench"
+#define BENCH_CMD_LEN (sizeof(BENCH_CMD) - 1)
+#define BENCH_PACKETS 64
+
+// Sending this on the CDC endpoint switches the UART to 1 Mbps
+#define FAST_CMD "fast"
+#define FAST_CMD_LEN (sizeof(FAST_CMD) - 1)
+
+// clang-format off
+volatile uint32_t *timer            = (volatile uint32_t *)TK1_MMIO_TIMER_TIMER;
+volatile uint32_t *timer_prescaler  = (volatile uint32_t *)TK1_MMIO_TIMER_PRESCALER;
+volatile uint32_t *timer_ctrl       = (volatile uint32_t *)TK1_MMIO_TIMER_CTRL;
+// clang-format on
+
 void sleep(uint32_t n)
 {
 	for (volatile int i = 0; i < n; i++)
 		;
 }
 
+// Start the timer counting down one step per clock cycle.
+void cycles_start(void)
+{
+	*timer_ctrl = (1 << TK1_MMIO_TIMER_CTRL_STOP_BIT);
+	*timer_prescaler = 1;
+	*timer = 0xffffffff;
+	*timer_ctrl = (1 << TK1_MMIO_TIMER_CTRL_START_BIT);
+}
+
+// Clock cycles since cycles_start()
+uint32_t cycles(void)
+{
+	return 0xffffffff - *timer;
+}
+
+void report(const char *what, uint32_t n)
+{
+	puts(IO_CDC, what);
+	putinthex(IO_CDC, n);
+	puts(IO_CDC, "\r\n");
+}
+
+// Send BENCH_PACKETS full packets to the CDC endpoint, first with
+// the blocking write() and then with write_nb(), and report the
+// clock cycles spent. The CPU is free to do other work for the
+// cycles between the write_nb() calls.
+void txbench(void)
+{
+	uint8_t packet[MAX_PAYLOAD_SIZE];
+	uint32_t in_write = 0;
+	uint32_t start = 0;
+
+	memset(packet, '.', sizeof(packet));
+	packet[MAX_PAYLOAD_SIZE - 2] = '\r';
+	packet[MAX_PAYLOAD_SIZE - 1] = '\n';
+
+	flush();
+	cycles_start();
+
+	for (int i = 0; i < BENCH_PACKETS; i++) {
+		write(IO_CDC, packet, sizeof(packet));
+	}
+
+	in_write = cycles();
+	flush();
+	report("write, cycles in calls: ", in_write);
+	report("write, cycles until flushed: ", cycles());
+
+	in_write = 0;
+	cycles_start();
+
+	for (int i = 0; i < BENCH_PACKETS;) {
+		start = cycles();
+		int n = write_nb(IO_CDC, packet, sizeof(packet));
+		in_write += cycles() - start;
+
+		if (n < 0) {
+			assert(1 == 2);
+		}
+
+		if (n == sizeof(packet)) {
+			i++;
+		}
+	}
+
+	flush();
+	report("write_nb, cycles in calls: ", in_write);
+	report("write_nb, cycles until flushed: ", cycles());
+}
+
 int main(void)
 {
 	uint8_t available = 0;
@@ -55,6 +141,25 @@ int main(void)
 			    0) {
 				assert(1 == 2);
 			}
+
+			if (available >= BENCH_CMD_LEN &&
+			    memeq(cmdbuf + 2, BENCH_CMD, BENCH_CMD_LEN)) {
+				txbench();
+				memset(cmdbuf, 0, BUFSIZE);
+				break;
+			}
+
+			if (available >= FAST_CMD_LEN &&
+			    memeq(cmdbuf + 2, FAST_CMD, FAST_CMD_LEN)) {
+				if (uart_set_bit_rate(UART_BIT_RATE_1M) == 0) {
+					puts(IO_CDC, "1 Mbps\r\n");
+				} else {
+					puts(IO_CDC, "Still 500 kbps\r\n");
+				}
+				memset(cmdbuf, 0, BUFSIZE);
+				break;
+			}
+
 			write(IO_DEBUG, cmdbuf, available + 2);
 			memset(cmdbuf, 0, BUFSIZE);
 			break;
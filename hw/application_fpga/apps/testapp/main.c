@@ -1,8 +1,10 @@
 // SPDX-FileCopyrightText: 2022 Tillitis AB <tillitis.se>
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <fw/tk1/boot_times.h>
 #include <fw/tk1/proto.h>
 #include <fw/tk1/reset.h>
+#include <fw/tk1/storage.h>
 #include <fw/tk1/syscall_num.h>
 #include <stdint.h>
 #include <tkey/assert.h>
@@ -131,6 +133,29 @@ int main(void)
 		anyfailed = 1;
 	}
 
+	puts(IO_CDC, "\r\nBoot times:\r\n");
+
+	struct boot_times boot_times = {0};
+	if (syscall(TK1_SYSCALL_GET_BOOT_TIMES, (uint32_t)&boot_times, 0,
+		    0) != 0) {
+		failmsg("Failed to get boot times");
+		anyfailed = 1;
+	}
+	for (int i = 0; i < BOOT_PHASES; i++) {
+		putinthex(IO_CDC, boot_times.cycles[i]);
+		puts(IO_CDC, "\r\n");
+		if (i > 0 && boot_times.cycles[i] < boot_times.cycles[i - 1]) {
+			failmsg("Boot times out of order");
+			anyfailed = 1;
+		}
+	}
+
+	if (syscall(TK1_SYSCALL_GET_BOOT_TIMES, TK1_MMIO_FW_RAM_BASE, 0, 0) ==
+	    0) {
+		failmsg("Got boot times into FW_RAM");
+		anyfailed = 1;
+	}
+
 	puts(IO_CDC, "\r\nAllocating storage area...");
 
 	if (syscall(TK1_SYSCALL_ALLOC_AREA, 0, 0, 0) != 0) {
@@ -160,6 +185,52 @@ int main(void)
 	}
 	puts(IO_CDC, "done.\r\n");
 
+	puts(IO_CDC, "\r\nReading data from storage area in pieces...");
+
+	// Read the second half first, into the first half of the
+	// buffer
+	(void)memset(in_data, 0, sizeof(in_data));
+	struct read_vec vec[2] = {
+	    {7, &in_data[0], 7},
+	    {0, &in_data[7], 7},
+	};
+	if (syscall(TK1_SYSCALL_READ_DATA_VEC, (uint32_t)vec, 2, 0) != 0) {
+		failmsg("Failed to read storage area in pieces");
+		anyfailed = 1;
+	}
+	if (!memeq(&in_data[0], &out_data[7], 7) ||
+	    !memeq(&in_data[7], &out_data[0], 7)) {
+		failmsg("Failed to read back data in pieces");
+		anyfailed = 1;
+	}
+
+	vec[1].buf = (uint8_t *)TK1_MMIO_FW_RAM_BASE;
+	if (syscall(TK1_SYSCALL_READ_DATA_VEC, (uint32_t)vec, 2, 0) == 0) {
+		failmsg("Read storage area into FW_RAM");
+		anyfailed = 1;
+	}
+	puts(IO_CDC, "done.\r\n");
+
+	puts(IO_CDC, "\r\nWriting across a flash page boundary...");
+
+	// Starts 6 bytes before the end of the first page
+	if (syscall(TK1_SYSCALL_WRITE_DATA, 250, (uint32_t)out_data,
+		    sizeof(out_data)) != 0) {
+		failmsg("Failed to write at unaligned offset");
+		anyfailed = 1;
+	}
+	(void)memset(in_data, 0, sizeof(in_data));
+	if (syscall(TK1_SYSCALL_READ_DATA, 250, (uint32_t)in_data,
+		    sizeof(in_data)) != 0) {
+		failmsg("Failed to read at unaligned offset");
+		anyfailed = 1;
+	}
+	if (!memeq(in_data, out_data, sizeof(in_data))) {
+		failmsg("Failed to read back data at unaligned offset");
+		anyfailed = 1;
+	}
+	puts(IO_CDC, "done.\r\n");
+
 	puts(IO_CDC, "\r\nErasing written data from storage area...");
 
 	if (syscall(TK1_SYSCALL_ERASE_DATA, 0, 4096, 0) != 0) {
@@ -182,6 +253,38 @@ int main(void)
 	}
 	puts(IO_CDC, "done.\r\n");
 
+	puts(IO_CDC, "\r\nErasing storage area without waiting...");
+
+	if (syscall(TK1_SYSCALL_WRITE_DATA, 4096, (uint32_t)out_data,
+		    sizeof(out_data)) != 0) {
+		failmsg("Failed to write to storage area");
+		anyfailed = 1;
+	}
+	if (syscall(TK1_SYSCALL_ERASE_DATA_START, 0, 8192, 0) != 0) {
+		failmsg("Failed to start erasing storage area");
+		anyfailed = 1;
+	}
+	// A sector erase takes milliseconds, so it's still running
+	if (syscall(TK1_SYSCALL_ERASE_DATA_STATUS, 0, 0, 0) != 1) {
+		failmsg("Erase not running");
+		anyfailed = 1;
+	}
+	// Reading waits for the erase to finish
+	if (syscall(TK1_SYSCALL_READ_DATA, 4096, (uint32_t)in_data,
+		    sizeof(in_data)) != 0) {
+		failmsg("Failed to read storage area while erasing");
+		anyfailed = 1;
+	}
+	if (syscall(TK1_SYSCALL_ERASE_DATA_STATUS, 0, 0, 0) != 0) {
+		failmsg("Erase still running after read");
+		anyfailed = 1;
+	}
+	if (!memeq(in_data, check_data, sizeof(check_data))) {
+		failmsg("Storage area not erased");
+		anyfailed = 1;
+	}
+	puts(IO_CDC, "done.\r\n");
+
 	puts(IO_CDC, "\r\nDeallocating storage area...");
 
 	if (syscall(TK1_SYSCALL_DEALLOC_AREA, 0, 0, 0) != 0) {
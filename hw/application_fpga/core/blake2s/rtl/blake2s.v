@@ -0,0 +1,207 @@
+//======================================================================
+//
+// blake2s.v
+// ---------
+// Top level wrapper for the BLAKE2s core.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module blake2s (
+    input wire clk,
+    input wire reset_n,
+
+    output wire          ram_req,
+    output wire [14 : 0] ram_addr,
+    input  wire          ram_ack,
+    input  wire [31 : 0] ram_read_data,
+
+    input  wire          cs,
+    input  wire          we,
+    input  wire [ 7 : 0] address,
+    input  wire [31 : 0] write_data,
+    output wire [31 : 0] read_data,
+    output wire          ready
+);
+
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  localparam ADDR_NAME0 = 8'h00;
+  localparam ADDR_NAME1 = 8'h01;
+  localparam ADDR_VERSION = 8'h02;
+
+  localparam ADDR_STATUS = 8'h09;
+  localparam STATUS_READY_BIT = 0;
+
+  localparam ADDR_SRC = 8'h10;
+  localparam ADDR_BLOCKS = 8'h11;
+
+  localparam ADDR_T0 = 8'h12;
+  localparam ADDR_T1 = 8'h13;
+
+  localparam ADDR_H0 = 8'h20;
+  localparam ADDR_H7 = 8'h27;
+
+  localparam CORE_NAME0 = 32'h626c616b;  // "blak"
+  localparam CORE_NAME1 = 32'h65327320;  // "e2s "
+  localparam CORE_VERSION = 32'h00000001;
+
+
+  //----------------------------------------------------------------
+  // Registers including update variables and write enable.
+  //----------------------------------------------------------------
+  reg  [14 : 0] src_reg;
+  reg           src_we;
+
+
+  //----------------------------------------------------------------
+  // Wires.
+  //----------------------------------------------------------------
+  reg  [31 : 0] tmp_read_data;
+  reg           tmp_ready;
+
+  reg           core_start;
+  reg           h_we;
+  reg           t_we;
+
+  wire [31 : 0] core_h_word;
+  wire [31 : 0] core_t_word;
+  wire [15 : 0] core_blocks_left;
+  wire          core_ready;
+
+
+  //----------------------------------------------------------------
+  // Concurrent connectivity for ports etc.
+  //----------------------------------------------------------------
+  assign read_data = tmp_read_data;
+  assign ready     = tmp_ready;
+
+
+  //----------------------------------------------------------------
+  // core instantiation.
+  //----------------------------------------------------------------
+  blake2s_core core (
+      .clk(clk),
+      .reset_n(reset_n),
+
+      .start (core_start),
+      .src   (src_reg),
+      .blocks(write_data[15 : 0]),
+
+      .h_we(h_we),
+      .t_we(t_we),
+      .word_addr(address[2 : 0]),
+      .write_data(write_data),
+      .h_word(core_h_word),
+      .t_word(core_t_word),
+      .blocks_left(core_blocks_left),
+
+      .ram_req(ram_req),
+      .ram_addr(ram_addr),
+      .ram_ack(ram_ack),
+      .ram_read_data(ram_read_data),
+
+      .ready(core_ready)
+  );
+
+
+  //----------------------------------------------------------------
+  // reg_update
+  //----------------------------------------------------------------
+  always @(posedge clk) begin : reg_update
+    if (!reset_n) begin
+      src_reg <= 15'h0;
+    end
+    else begin
+      if (src_we) begin
+        src_reg <= write_data[16 : 2];
+      end
+    end
+  end  // reg_update
+
+
+  //----------------------------------------------------------------
+  // api
+  //
+  // The interface command decoding logic. The source, counter and
+  // chaining value can only be written while the core is ready.
+  // Writing the number of blocks starts the core.
+  //----------------------------------------------------------------
+  always @* begin : api
+    src_we        = 1'h0;
+    core_start    = 1'h0;
+    h_we          = 1'h0;
+    t_we          = 1'h0;
+    tmp_read_data = 32'h0;
+    tmp_ready     = 1'h0;
+
+    if (cs) begin
+      tmp_ready = 1'h1;
+
+      if (we) begin
+        if (core_ready) begin
+          if (address == ADDR_SRC) begin
+            src_we = 1'h1;
+          end
+
+          if (address == ADDR_BLOCKS) begin
+            core_start = 1'h1;
+          end
+
+          if ((address == ADDR_T0) || (address == ADDR_T1)) begin
+            t_we = 1'h1;
+          end
+
+          if ((address >= ADDR_H0) && (address <= ADDR_H7)) begin
+            h_we = 1'h1;
+          end
+        end
+      end
+
+      else begin
+        if (address == ADDR_NAME0) begin
+          tmp_read_data = CORE_NAME0;
+        end
+
+        if (address == ADDR_NAME1) begin
+          tmp_read_data = CORE_NAME1;
+        end
+
+        if (address == ADDR_VERSION) begin
+          tmp_read_data = CORE_VERSION;
+        end
+
+        if (address == ADDR_STATUS) begin
+          tmp_read_data[STATUS_READY_BIT] = core_ready;
+        end
+
+        if (address == ADDR_SRC) begin
+          tmp_read_data = {15'h0, src_reg, 2'h0};
+        end
+
+        if (address == ADDR_BLOCKS) begin
+          tmp_read_data = {16'h0, core_blocks_left};
+        end
+
+        if ((address == ADDR_T0) || (address == ADDR_T1)) begin
+          tmp_read_data = core_t_word;
+        end
+
+        if ((address >= ADDR_H0) && (address <= ADDR_H7)) begin
+          tmp_read_data = core_h_word;
+        end
+      end
+    end
+  end  // api
+endmodule  // blake2s
+
+//======================================================================
+// EOF blake2s.v
+//======================================================================
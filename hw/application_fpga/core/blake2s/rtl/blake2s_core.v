@@ -0,0 +1,586 @@
+//======================================================================
+//
+// blake2s_core.v
+// --------------
+// BLAKE2s compression engine. Reads 64 byte message blocks from
+// RAM and compresses them into the chaining value h, updating the
+// counter t. Padding and the final block is left to SW.
+//
+// The working vector v is kept as four rows of four words. Half a
+// G function is performed every cycle on the first column, after
+// which the rows are rotated so that the next column comes into
+// position. The diagonal rounds are handled by rotating the rows
+// a different number of words after the last column. A block takes
+// 163 cycles to compress.
+//
+// The message block is read from RAM one word at a time, in cycles
+// where the CPU isn't accessing the RAM. The message memory holds
+// two blocks, so the next block is read while the current one is
+// compressed.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module blake2s_core (
+    input wire clk,
+    input wire reset_n,
+
+    input wire          start,
+    input wire [14 : 0] src,
+    input wire [15 : 0] blocks,
+
+    input  wire          h_we,
+    input  wire          t_we,
+    input  wire [ 2 : 0] word_addr,
+    input  wire [31 : 0] write_data,
+    output wire [31 : 0] h_word,
+    output wire [31 : 0] t_word,
+    output wire [15 : 0] blocks_left,
+
+    output wire          ram_req,
+    output wire [14 : 0] ram_addr,
+    input  wire          ram_ack,
+    input  wire [31 : 0] ram_read_data,
+
+    output wire          ready
+);
+
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  localparam CTRL_IDLE = 2'h0;
+  localparam CTRL_INIT = 2'h1;
+  localparam CTRL_ROUNDS = 2'h2;
+  localparam CTRL_FINAL = 2'h3;
+
+  localparam IV0 = 32'h6a09e667;
+  localparam IV1 = 32'hbb67ae85;
+  localparam IV2 = 32'h3c6ef372;
+  localparam IV3 = 32'ha54ff53a;
+  localparam IV4 = 32'h510e527f;
+  localparam IV5 = 32'h9b05688c;
+  localparam IV6 = 32'h1f83d9ab;
+  localparam IV7 = 32'h5be0cd19;
+
+  localparam BLOCK_BYTES = 64'h40;
+
+
+  //----------------------------------------------------------------
+  // Functions.
+  //----------------------------------------------------------------
+  // The message schedule. Word i of round r is m[sigma(r, i)].
+  function [3 : 0] sigma(input [3 : 0] round, input [3 : 0] i);
+    reg [63 : 0] row;
+    begin
+      case (round)
+        4'h0: row = 64'hfedcba9876543210;
+        4'h1: row = 64'h357b20c16df984ae;
+        4'h2: row = 64'h491763eadf250c8b;
+        4'h3: row = 64'h8f04a562ebcd1397;
+        4'h4: row = 64'hd386cb1efa427509;
+        4'h5: row = 64'h91ef57d438b0a6c2;
+        4'h6: row = 64'hb8293670a4def15c;
+        4'h7: row = 64'ha2684f05931ce7bd;
+        4'h8: row = 64'h5a417d2c803b9ef6;
+        4'h9: row = 64'h0dc3e9bf5167482a;
+        default: row = 64'hfedcba9876543210;
+      endcase
+      sigma = row[{i, 2'h0}+:4];
+    end
+  endfunction
+
+
+  //----------------------------------------------------------------
+  // Registers including update variables and write enable.
+  //----------------------------------------------------------------
+  reg [31 : 0] h_reg          [0 : 7];
+  reg          h_update;
+
+  reg [63 : 0] t_reg;
+  reg [63 : 0] t_new;
+  reg          t_update;
+
+  reg [31 : 0] v_reg          [0 : 15];
+  reg [31 : 0] v_new          [0 : 15];
+  reg          v_we;
+
+  reg [31 : 0] m_mem          [0 : 31];
+  reg [31 : 0] m_reg;
+  reg [ 4 : 0] m_raddr;
+
+  reg [14 : 0] fetch_addr_reg;
+  reg [14 : 0] fetch_addr_new;
+  reg          fetch_addr_we;
+
+  reg [15 : 0] fetch_left_reg;
+  reg [15 : 0] fetch_left_new;
+  reg          fetch_left_we;
+
+  reg [ 3 : 0] fetch_word_reg;
+  reg [ 3 : 0] fetch_word_new;
+  reg          fetch_word_we;
+
+  reg          fetch_bank_reg;
+  reg          fetch_bank_new;
+  reg          fetch_bank_we;
+
+  reg          fetch_ack_reg;
+
+  reg [ 1 : 0] bank_full_reg;
+  reg [ 1 : 0] bank_full_new;
+  reg          bank_full_we;
+
+  reg [15 : 0] comp_left_reg;
+  reg [15 : 0] comp_left_new;
+  reg          comp_left_we;
+
+  reg          comp_bank_reg;
+  reg          comp_bank_new;
+  reg          comp_bank_we;
+
+  reg [ 3 : 0] round_ctr_reg;
+  reg [ 3 : 0] round_ctr_new;
+  reg          round_ctr_we;
+
+  reg [ 3 : 0] step_ctr_reg;
+  reg [ 3 : 0] step_ctr_new;
+  reg          step_ctr_we;
+
+  reg [ 1 : 0] blake2s_ctrl_reg;
+  reg [ 1 : 0] blake2s_ctrl_new;
+  reg          blake2s_ctrl_we;
+
+
+  //----------------------------------------------------------------
+  // Wires.
+  //----------------------------------------------------------------
+  reg          v_init;
+  reg          v_step;
+  reg          release_bank;
+
+  reg [31 : 0] a_new;
+  reg [31 : 0] b_new;
+  reg [31 : 0] c_new;
+  reg [31 : 0] d_new;
+
+
+  //----------------------------------------------------------------
+  // Concurrent connectivity for ports etc.
+  //----------------------------------------------------------------
+  assign h_word      = h_reg[word_addr];
+  assign t_word      = word_addr[0] ? t_reg[63 : 32] : t_reg[31 : 0];
+  assign blocks_left = comp_left_reg;
+
+  assign ram_req     = (|fetch_left_reg) && !bank_full_reg[fetch_bank_reg] && !fetch_ack_reg;
+  assign ram_addr    = fetch_addr_reg;
+
+  assign ready       = ~|comp_left_reg;
+
+
+  //----------------------------------------------------------------
+  // reg_update
+  //----------------------------------------------------------------
+  always @(posedge clk) begin : reg_update
+    integer i;
+
+    if (!reset_n) begin
+      for (i = 0; i < 8; i = i + 1) begin
+        h_reg[i] <= 32'h0;
+      end
+
+      for (i = 0; i < 16; i = i + 1) begin
+        v_reg[i] <= 32'h0;
+      end
+
+      t_reg            <= 64'h0;
+      fetch_addr_reg   <= 15'h0;
+      fetch_left_reg   <= 16'h0;
+      fetch_word_reg   <= 4'h0;
+      fetch_bank_reg   <= 1'h0;
+      fetch_ack_reg    <= 1'h0;
+      bank_full_reg    <= 2'h0;
+      comp_left_reg    <= 16'h0;
+      comp_bank_reg    <= 1'h0;
+      round_ctr_reg    <= 4'h0;
+      step_ctr_reg     <= 4'h0;
+      blake2s_ctrl_reg <= CTRL_IDLE;
+    end
+
+    else begin
+      fetch_ack_reg <= ram_ack;
+
+      if (h_update) begin
+        for (i = 0; i < 8; i = i + 1) begin
+          h_reg[i] <= h_reg[i] ^ v_reg[i] ^ v_reg[i + 8];
+        end
+      end
+
+      if (h_we) begin
+        h_reg[word_addr] <= write_data;
+      end
+
+      if (t_update) begin
+        t_reg <= t_new;
+      end
+
+      if (t_we) begin
+        if (word_addr[0]) begin
+          t_reg[63 : 32] <= write_data;
+        end
+        else begin
+          t_reg[31 : 0] <= write_data;
+        end
+      end
+
+      if (v_we) begin
+        for (i = 0; i < 16; i = i + 1) begin
+          v_reg[i] <= v_new[i];
+        end
+      end
+
+      if (fetch_addr_we) begin
+        fetch_addr_reg <= fetch_addr_new;
+      end
+
+      if (fetch_left_we) begin
+        fetch_left_reg <= fetch_left_new;
+      end
+
+      if (fetch_word_we) begin
+        fetch_word_reg <= fetch_word_new;
+      end
+
+      if (fetch_bank_we) begin
+        fetch_bank_reg <= fetch_bank_new;
+      end
+
+      if (bank_full_we) begin
+        bank_full_reg <= bank_full_new;
+      end
+
+      if (comp_left_we) begin
+        comp_left_reg <= comp_left_new;
+      end
+
+      if (comp_bank_we) begin
+        comp_bank_reg <= comp_bank_new;
+      end
+
+      if (round_ctr_we) begin
+        round_ctr_reg <= round_ctr_new;
+      end
+
+      if (step_ctr_we) begin
+        step_ctr_reg <= step_ctr_new;
+      end
+
+      if (blake2s_ctrl_we) begin
+        blake2s_ctrl_reg <= blake2s_ctrl_new;
+      end
+    end
+  end  // reg_update
+
+
+  //----------------------------------------------------------------
+  // m_mem_update
+  //
+  // The message memory, two blocks of 16 words. Should be
+  // implemented using EBRs.
+  //----------------------------------------------------------------
+  always @(posedge clk) begin : m_mem_update
+    if (fetch_ack_reg) begin
+      m_mem[{fetch_bank_reg, fetch_word_reg}] <= ram_read_data;
+    end
+
+    m_reg <= m_mem[m_raddr];
+  end  // m_mem_update
+
+
+  //----------------------------------------------------------------
+  // g_half
+  //
+  // Half of the G function, on the first column of v. The first
+  // half uses the rotations 16 and 12, the second half 8 and 7.
+  // m_reg holds the message word for the current step.
+  //----------------------------------------------------------------
+  always @* begin : g_half
+    reg [31 : 0] d_xor;
+    reg [31 : 0] b_xor;
+
+    a_new = v_reg[0] + v_reg[4] + m_reg;
+    d_xor = v_reg[12] ^ a_new;
+
+    if (step_ctr_reg[0]) begin
+      d_new = {d_xor[7 : 0], d_xor[31 : 8]};
+    end
+    else begin
+      d_new = {d_xor[15 : 0], d_xor[31 : 16]};
+    end
+
+    c_new = v_reg[8] + d_new;
+    b_xor = v_reg[4] ^ c_new;
+
+    if (step_ctr_reg[0]) begin
+      b_new = {b_xor[6 : 0], b_xor[31 : 7]};
+    end
+    else begin
+      b_new = {b_xor[11 : 0], b_xor[31 : 12]};
+    end
+  end  // g_half
+
+
+  //----------------------------------------------------------------
+  // state_logic
+  //
+  // Initialization of v, the rounds with the rotation of the rows,
+  // and the update of h and t.
+  //----------------------------------------------------------------
+  always @* begin : state_logic
+    integer i;
+
+    for (i = 0; i < 16; i = i + 1) begin
+      v_new[i] = v_reg[i];
+    end
+
+    h_update = 1'h0;
+    t_new    = t_reg + BLOCK_BYTES;
+    t_update = 1'h0;
+    v_we     = 1'h0;
+
+    if (v_init) begin
+      for (i = 0; i < 8; i = i + 1) begin
+        v_new[i] = h_reg[i];
+      end
+
+      v_new[8]  = IV0;
+      v_new[9]  = IV1;
+      v_new[10] = IV2;
+      v_new[11] = IV3;
+      v_new[12] = IV4 ^ t_new[31 : 0];
+      v_new[13] = IV5 ^ t_new[63 : 32];
+      v_new[14] = IV6;
+      v_new[15] = IV7;
+      t_update  = 1'h1;
+      v_we      = 1'h1;
+    end
+
+    if (v_step) begin
+      v_we = 1'h1;
+
+      if (!step_ctr_reg[0]) begin
+        v_new[0]  = a_new;
+        v_new[4]  = b_new;
+        v_new[8]  = c_new;
+        v_new[12] = d_new;
+      end
+
+      else begin
+        // Row 0 is always just rotated one word.
+        v_new[0] = v_reg[1];
+        v_new[1] = v_reg[2];
+        v_new[2] = v_reg[3];
+        v_new[3] = a_new;
+
+        case (step_ctr_reg[3 : 1])
+          3'h3: begin
+            // Last column. Rotate row n another n words so that
+            // the diagonals become columns.
+            v_new[4]  = v_reg[6];
+            v_new[5]  = v_reg[7];
+            v_new[6]  = b_new;
+            v_new[7]  = v_reg[5];
+
+            v_new[8]  = v_reg[11];
+            v_new[9]  = c_new;
+            v_new[10] = v_reg[9];
+            v_new[11] = v_reg[10];
+
+            v_new[12] = d_new;
+            v_new[13] = v_reg[13];
+            v_new[14] = v_reg[14];
+            v_new[15] = v_reg[15];
+          end
+
+          3'h7: begin
+            // Last diagonal. Rotate the rows back.
+            v_new[4]  = b_new;
+            v_new[5]  = v_reg[5];
+            v_new[6]  = v_reg[6];
+            v_new[7]  = v_reg[7];
+
+            v_new[8]  = v_reg[11];
+            v_new[9]  = c_new;
+            v_new[10] = v_reg[9];
+            v_new[11] = v_reg[10];
+
+            v_new[12] = v_reg[14];
+            v_new[13] = v_reg[15];
+            v_new[14] = d_new;
+            v_new[15] = v_reg[13];
+          end
+
+          default: begin
+            v_new[4]  = v_reg[5];
+            v_new[5]  = v_reg[6];
+            v_new[6]  = v_reg[7];
+            v_new[7]  = b_new;
+
+            v_new[8]  = v_reg[9];
+            v_new[9]  = v_reg[10];
+            v_new[10] = v_reg[11];
+            v_new[11] = c_new;
+
+            v_new[12] = v_reg[13];
+            v_new[13] = v_reg[14];
+            v_new[14] = v_reg[15];
+            v_new[15] = d_new;
+          end
+        endcase
+      end
+    end
+
+    if (release_bank) begin
+      h_update = 1'h1;
+    end
+  end  // state_logic
+
+
+  //----------------------------------------------------------------
+  // fetch_logic
+  //
+  // Reads the message blocks from RAM into the free bank of the
+  // message memory. The address must stay the same in the cycle
+  // after the ack, when the data is read.
+  //----------------------------------------------------------------
+  always @* begin : fetch_logic
+    fetch_addr_new = fetch_addr_reg + 1'h1;
+    fetch_addr_we  = 1'h0;
+    fetch_left_new = fetch_left_reg - 1'h1;
+    fetch_left_we  = 1'h0;
+    fetch_word_new = fetch_word_reg + 1'h1;
+    fetch_word_we  = 1'h0;
+    fetch_bank_new = ~fetch_bank_reg;
+    fetch_bank_we  = 1'h0;
+    bank_full_new  = bank_full_reg;
+    bank_full_we   = 1'h0;
+
+    if (fetch_ack_reg) begin
+      fetch_addr_we = 1'h1;
+      fetch_word_we = 1'h1;
+
+      if (fetch_word_reg == 4'hf) begin
+        fetch_left_we                 = 1'h1;
+        fetch_bank_we                 = 1'h1;
+        bank_full_new[fetch_bank_reg] = 1'h1;
+        bank_full_we                  = 1'h1;
+      end
+    end
+
+    if (release_bank) begin
+      bank_full_new[comp_bank_reg] = 1'h0;
+      bank_full_we                 = 1'h1;
+    end
+
+    if (start) begin
+      fetch_addr_new = src;
+      fetch_addr_we  = 1'h1;
+      fetch_left_new = blocks;
+      fetch_left_we  = 1'h1;
+      fetch_word_new = 4'h0;
+      fetch_word_we  = 1'h1;
+      fetch_bank_new = 1'h0;
+      fetch_bank_we  = 1'h1;
+      bank_full_new  = 2'h0;
+      bank_full_we   = 1'h1;
+    end
+  end  // fetch_logic
+
+
+  //----------------------------------------------------------------
+  // blake2s_ctrl
+  //
+  // Compresses the blocks as they become available. The message
+  // word for a step is read from the memory in the cycle before.
+  //----------------------------------------------------------------
+  always @* begin : blake2s_ctrl
+    v_init           = 1'h0;
+    v_step           = 1'h0;
+    release_bank     = 1'h0;
+    comp_left_new    = comp_left_reg - 1'h1;
+    comp_left_we     = 1'h0;
+    comp_bank_new    = ~comp_bank_reg;
+    comp_bank_we     = 1'h0;
+    round_ctr_new    = 4'h0;
+    round_ctr_we     = 1'h0;
+    step_ctr_new     = 4'h0;
+    step_ctr_we      = 1'h0;
+    blake2s_ctrl_new = CTRL_IDLE;
+    blake2s_ctrl_we  = 1'h0;
+    m_raddr          = {comp_bank_reg, sigma(4'h0, 4'h0)};
+
+    case (blake2s_ctrl_reg)
+      CTRL_IDLE: begin
+        if (start) begin
+          comp_left_new = blocks;
+          comp_left_we  = 1'h1;
+          comp_bank_new = 1'h0;
+          comp_bank_we  = 1'h1;
+        end
+
+        else if ((|comp_left_reg) && bank_full_reg[comp_bank_reg]) begin
+          blake2s_ctrl_new = CTRL_INIT;
+          blake2s_ctrl_we  = 1'h1;
+        end
+      end
+
+      CTRL_INIT: begin
+        v_init           = 1'h1;
+        round_ctr_new    = 4'h0;
+        round_ctr_we     = 1'h1;
+        step_ctr_new     = 4'h0;
+        step_ctr_we      = 1'h1;
+        blake2s_ctrl_new = CTRL_ROUNDS;
+        blake2s_ctrl_we  = 1'h1;
+      end
+
+      CTRL_ROUNDS: begin
+        v_step       = 1'h1;
+        step_ctr_new = step_ctr_reg + 1'h1;
+        step_ctr_we  = 1'h1;
+        m_raddr      = {comp_bank_reg, sigma(round_ctr_reg, step_ctr_reg + 1'h1)};
+
+        if (step_ctr_reg == 4'hf) begin
+          round_ctr_new = round_ctr_reg + 1'h1;
+          round_ctr_we  = 1'h1;
+          m_raddr       = {comp_bank_reg, sigma(round_ctr_reg + 1'h1, 4'h0)};
+
+          if (round_ctr_reg == 4'h9) begin
+            blake2s_ctrl_new = CTRL_FINAL;
+            blake2s_ctrl_we  = 1'h1;
+          end
+        end
+      end
+
+      CTRL_FINAL: begin
+        release_bank     = 1'h1;
+        comp_left_we     = 1'h1;
+        comp_bank_we     = 1'h1;
+        blake2s_ctrl_new = CTRL_IDLE;
+        blake2s_ctrl_we  = 1'h1;
+      end
+
+      default: begin
+      end
+    endcase
+  end  // blake2s_ctrl
+endmodule  // blake2s_core
+
+//======================================================================
+// EOF blake2s_core.v
+//======================================================================
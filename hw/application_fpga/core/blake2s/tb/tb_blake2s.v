@@ -0,0 +1,536 @@
+//======================================================================
+//
+// tb_blake2s.v
+// ------------
+// Testbench for the BLAKE2s core. The RAM the core reads the
+// message from is modelled in the testbench.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module tb_blake2s ();
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  parameter DEBUG = 0;
+
+  parameter CLK_HALF_PERIOD = 1;
+  parameter CLK_PERIOD = 2 * CLK_HALF_PERIOD;
+
+  localparam ADDR_NAME0 = 8'h00;
+  localparam ADDR_NAME1 = 8'h01;
+  localparam ADDR_VERSION = 8'h02;
+
+  localparam ADDR_STATUS = 8'h09;
+  localparam STATUS_READY_BIT = 0;
+
+  localparam ADDR_SRC = 8'h10;
+  localparam ADDR_BLOCKS = 8'h11;
+
+  localparam ADDR_T0 = 8'h12;
+  localparam ADDR_T1 = 8'h13;
+
+  localparam ADDR_H0 = 8'h20;
+
+  // The chaining value after initialization for a 32 byte digest
+  // without key.
+  localparam H_INIT = 256'h5be0cd19_1f83d9ab_9b05688c_510e527f_a54ff53a_3c6ef372_bb67ae85_6b08e647;
+
+  localparam RAM_WORDS = 32768;
+
+  // Documented latency of a block. The prefetch of the next block
+  // must hide the RAM, so a long hash may only add a fixed setup,
+  // first block fetch and readout overhead on top of it.
+  localparam BLOCK_CYCLES = 163;
+  localparam HASH_OVERHEAD = 256;
+
+
+  //----------------------------------------------------------------
+  // Register and Wire declarations.
+  //----------------------------------------------------------------
+  reg  [31 : 0] cycle_ctr;
+  reg  [31 : 0] error_ctr;
+  reg  [31 : 0] tc_ctr;
+  reg           tb_monitor;
+
+  reg           tb_clk;
+  reg           tb_reset_n;
+  reg           tb_cs;
+  reg           tb_we;
+  reg  [ 7 : 0] tb_address;
+  reg  [31 : 0] tb_write_data;
+  wire [31 : 0] tb_read_data;
+  wire          tb_ready;
+
+  wire          tb_ram_req;
+  wire [14 : 0] tb_ram_addr;
+  reg           tb_ram_ack;
+  reg           tb_ram_ack_reg;
+  reg  [31 : 0] tb_ram_read_data;
+  reg           tb_ram_busy;
+  reg  [31 : 0] tb_ram          [0 : (RAM_WORDS - 1)];
+
+  reg  [31 : 0] read_data;
+  reg  [255 : 0] digest;
+
+
+  //----------------------------------------------------------------
+  // Device Under Test.
+  //----------------------------------------------------------------
+  blake2s dut (
+      .clk(tb_clk),
+      .reset_n(tb_reset_n),
+
+      .ram_req(tb_ram_req),
+      .ram_addr(tb_ram_addr),
+      .ram_ack(tb_ram_ack),
+      .ram_read_data(tb_ram_read_data),
+
+      .cs(tb_cs),
+      .we(tb_we),
+      .address(tb_address),
+      .write_data(tb_write_data),
+      .read_data(tb_read_data),
+      .ready(tb_ready)
+  );
+
+
+  //----------------------------------------------------------------
+  // clk_gen
+  //
+  // Always running clock generator process.
+  //----------------------------------------------------------------
+  always begin : clk_gen
+    #CLK_HALF_PERIOD;
+    tb_clk = !tb_clk;
+  end  // clk_gen
+
+
+  //----------------------------------------------------------------
+  // sys_monitor()
+  //
+  // An always running process that creates a cycle counter and
+  // conditionally displays information about the DUT.
+  //----------------------------------------------------------------
+  always begin : sys_monitor
+    cycle_ctr = cycle_ctr + 1;
+    #(CLK_PERIOD);
+    if (tb_monitor) begin
+      dump_dut_state();
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // ram_model
+  //
+  // Acks a request in cycles where the RAM isn't busy. When
+  // tb_ram_busy is set, the RAM is busy two cycles out of three,
+  // like when the CPU is fetching instructions from it. The data
+  // comes in the cycle after the ack, from the address given then.
+  //----------------------------------------------------------------
+  always @(posedge tb_clk) begin : ram_model
+    if (!tb_reset_n) begin
+      tb_ram_ack_reg <= 1'h0;
+    end
+    else begin
+      tb_ram_ack_reg <= tb_ram_ack;
+    end
+  end
+
+  always @* begin : ram_ack
+    tb_ram_ack       = tb_ram_req && !tb_ram_ack_reg && (!tb_ram_busy || (cycle_ctr % 3 == 0));
+    tb_ram_read_data = 32'h0;
+
+    if (tb_ram_ack_reg) begin
+      tb_ram_read_data = tb_ram[tb_ram_addr];
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // dump_dut_state()
+  //
+  // Dump the state of the dump when needed.
+  //----------------------------------------------------------------
+  task dump_dut_state;
+    begin
+      $display("State of DUT");
+      $display("------------");
+      $display("Cycle: %08d", cycle_ctr);
+      $display("");
+      $display("Inputs and outputs:");
+      $display(
+          "cs: 0x%1x, we: 0x%1x, address: 0x%02x, write_data: 0x%08x, read_data: 0x%08x, ready: 0x%1x",
+          tb_cs, tb_we, tb_address, tb_write_data, tb_read_data, tb_ready);
+      $display("ram_req: 0x%1x, ram_addr: 0x%04x, ram_ack: 0x%1x, ram_read_data: 0x%08x",
+               tb_ram_req, tb_ram_addr, tb_ram_ack, tb_ram_read_data);
+      $display("");
+      $display("Internal state:");
+      $display("ctrl: 0x%1x, round: 0x%1x, step: 0x%1x, comp_left: 0x%04x, comp_bank: 0x%1x",
+               dut.core.blake2s_ctrl_reg, dut.core.round_ctr_reg, dut.core.step_ctr_reg,
+               dut.core.comp_left_reg, dut.core.comp_bank_reg);
+      $display("fetch_left: 0x%04x, fetch_word: 0x%1x, fetch_bank: 0x%1x, bank_full: 0x%1x",
+               dut.core.fetch_left_reg, dut.core.fetch_word_reg, dut.core.fetch_bank_reg,
+               dut.core.bank_full_reg);
+      $display("v0: 0x%08x, v4: 0x%08x, v8: 0x%08x, v12: 0x%08x, m: 0x%08x",
+               dut.core.v_reg[0], dut.core.v_reg[4], dut.core.v_reg[8], dut.core.v_reg[12],
+               dut.core.m_reg);
+      $display("");
+      $display("");
+    end
+  endtask  // dump_dut_state
+
+
+  //----------------------------------------------------------------
+  // reset_dut()
+  //
+  // Toggle reset to put the DUT into a well known state.
+  //----------------------------------------------------------------
+  task reset_dut;
+    begin
+      $display("--- Toggle reset.");
+      tb_reset_n = 0;
+      #(2 * CLK_PERIOD);
+      tb_reset_n = 1;
+    end
+  endtask  // reset_dut
+
+
+  //----------------------------------------------------------------
+  // display_test_result()
+  //
+  // Display the accumulated test results.
+  //----------------------------------------------------------------
+  task display_test_result;
+    begin
+      if (error_ctr == 0) begin
+        $display("--- All %02d test cases completed successfully", tc_ctr);
+      end
+      else begin
+        $display("--- %02d tests completed - %02d test cases did not complete successfully.",
+                 tc_ctr, error_ctr);
+      end
+    end
+  endtask  // display_test_result
+
+
+  //----------------------------------------------------------------
+  // init_sim()
+  //
+  // Initialize all counters and testbed functionality as well
+  // as setting the DUT inputs to defined values. The RAM is
+  // filled with a known pattern.
+  //----------------------------------------------------------------
+  task init_sim;
+    begin : init_sim
+      integer i;
+
+      cycle_ctr     = 0;
+      error_ctr     = 0;
+      tc_ctr        = 0;
+      tb_monitor    = 0;
+
+      tb_clk        = 1'h0;
+      tb_reset_n    = 1'h1;
+      tb_cs         = 1'h0;
+      tb_we         = 1'h0;
+      tb_address    = 8'h0;
+      tb_write_data = 32'h0;
+      tb_ram_busy   = 1'h0;
+
+      for (i = 0; i < RAM_WORDS; i = i + 1) begin
+        tb_ram[i] = i * 32'h9e3779b9;
+      end
+    end
+  endtask  // init_sim
+
+
+  //----------------------------------------------------------------
+  // write_word()
+  //
+  // Write the given word to the DUT using the DUT interface.
+  //----------------------------------------------------------------
+  task write_word(input [7 : 0] address, input [31 : 0] word);
+    begin
+      if (DEBUG) begin
+        $display("--- Writing 0x%08x to 0x%02x.", word, address);
+        $display("");
+      end
+
+      tb_address = address;
+      tb_write_data = word;
+      tb_cs = 1;
+      tb_we = 1;
+      #(CLK_PERIOD);
+      tb_cs = 0;
+      tb_we = 0;
+    end
+  endtask  // write_word
+
+
+  //----------------------------------------------------------------
+  // read_word()
+  //
+  // Read a data word from the given address in the DUT.
+  // the word read will be available in the global variable
+  // read_data.
+  //----------------------------------------------------------------
+  task read_word(input [7 : 0] address);
+    begin
+      tb_address = address;
+      tb_cs = 1;
+      tb_we = 0;
+      #(CLK_PERIOD);
+      read_data = tb_read_data;
+      tb_cs = 0;
+
+      if (DEBUG) begin
+        $display("--- Reading 0x%08x from 0x%02x.", read_data, address);
+        $display("");
+      end
+    end
+  endtask  // read_word
+
+
+  //----------------------------------------------------------------
+  // check_word()
+  //
+  // Read a word and compare it to the expected value.
+  //----------------------------------------------------------------
+  task check_word(input [7 : 0] address, input [31 : 0] expected);
+    begin
+      read_word(address);
+      if (read_data != expected) begin
+        $display("--- Error: Got 0x%08x from 0x%02x, expected 0x%08x.", read_data, address,
+                 expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_word
+
+
+  //----------------------------------------------------------------
+  // wait_ready()
+  //
+  // Wait for the ready flag to be set in dut.
+  //----------------------------------------------------------------
+  task wait_ready;
+    begin : wready
+      read_word(ADDR_STATUS);
+      while (read_data[STATUS_READY_BIT] == 0) read_word(ADDR_STATUS);
+    end
+  endtask  // wait_ready
+
+
+  //----------------------------------------------------------------
+  // hash_blocks()
+  //
+  // Set up the chaining value and counter for the first block of
+  // an unkeyed hash, compress the given number of blocks from RAM
+  // and read out the chaining value into digest.
+  //----------------------------------------------------------------
+  task hash_blocks(input [31 : 0] src, input [15 : 0] blocks);
+    begin : hash_blocks
+      integer i;
+
+      for (i = 0; i < 8; i = i + 1) begin
+        write_word(ADDR_H0 + i[7 : 0], H_INIT[i*32+:32]);
+      end
+
+      write_word(ADDR_T0, 32'h0);
+      write_word(ADDR_T1, 32'h0);
+      write_word(ADDR_SRC, src);
+      write_word(ADDR_BLOCKS, {16'h0, blocks});
+      wait_ready();
+
+      for (i = 0; i < 8; i = i + 1) begin
+        read_word(ADDR_H0 + i[7 : 0]);
+        digest[i*32+:32] = read_data;
+      end
+    end
+  endtask  // hash_blocks
+
+
+  //----------------------------------------------------------------
+  // check_digest()
+  //----------------------------------------------------------------
+  task check_digest(input [255 : 0] expected);
+    begin
+      if (digest == expected) begin
+        $display("--- Correct chaining value.");
+      end
+      else begin
+        $display("--- Error: Got chaining value 0x%064x", digest);
+        $display("--- expected 0x%064x", expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_digest
+
+
+  //----------------------------------------------------------------
+  // test1()
+  // Read the name and version of the core.
+  //----------------------------------------------------------------
+  task test1;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test1: started.");
+
+      check_word(ADDR_NAME0, 32'h626c616b);
+      check_word(ADDR_NAME1, 32'h65327320);
+      check_word(ADDR_VERSION, 32'h00000001);
+      check_word(ADDR_STATUS, 32'h00000001);
+
+      $display("--- test1: completed.");
+      $display("");
+    end
+  endtask  // test1
+
+
+  //----------------------------------------------------------------
+  // test2()
+  // Compress two blocks starting at 0x100 in RAM. Check the
+  // chaining value and that the counter was updated.
+  //----------------------------------------------------------------
+  task test2;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test2: started.");
+
+      hash_blocks(32'h100, 16'h2);
+      check_digest(
+          256'hb35e994a_b3effc44_434374c5_69743df8_b1c8c95e_36698c95_eafdcf35_d4fd2b89);
+      check_word(ADDR_T0, 32'h80);
+      check_word(ADDR_T1, 32'h0);
+      check_word(ADDR_BLOCKS, 32'h0);
+
+      $display("--- test2: completed.");
+      $display("");
+    end
+  endtask  // test2
+
+
+  //----------------------------------------------------------------
+  // test3()
+  // Compress all of the 128 KiB RAM, with the RAM busy most of
+  // the time. Check that it runs at the documented block latency.
+  //----------------------------------------------------------------
+  task test3;
+    begin : test3
+      reg [31 : 0] start_cycle;
+      reg [31 : 0] cycles;
+
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test3: started.");
+
+      tb_ram_busy = 1'h1;
+      start_cycle = cycle_ctr;
+      hash_blocks(32'h0, 16'd2048);
+      cycles = cycle_ctr - start_cycle;
+      tb_ram_busy = 1'h0;
+
+      check_digest(
+          256'ha775aca5_1d07b29b_ea5ca297_af47ce66_32585403_ff7ab7f5_8647c887_7f030c11);
+      check_word(ADDR_T0, 32'h20000);
+
+      $display("--- test3: 128 KiB in %0d cycles, %0d us at 24 MHz.", cycles, cycles / 24);
+      if ((cycles < 2048 * BLOCK_CYCLES) || (cycles > 2048 * BLOCK_CYCLES + HASH_OVERHEAD)) begin
+        $display("--- Error: Expected %0d cycles per block.", BLOCK_CYCLES);
+        error_ctr = error_ctr + 1;
+      end
+      $display("--- test3: completed.");
+      $display("");
+    end
+  endtask  // test3
+
+
+  //----------------------------------------------------------------
+  // test4()
+  // Check that the chaining value can't be changed while the core
+  // is busy.
+  //----------------------------------------------------------------
+  task test4;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test4: started.");
+
+      write_word(ADDR_H0, 32'h0);
+      write_word(ADDR_SRC, 32'h0);
+      write_word(ADDR_BLOCKS, 32'h1);
+      check_word(ADDR_STATUS, 32'h0);
+      write_word(ADDR_H0, 32'hdeadbeef);
+      wait_ready();
+
+      read_word(ADDR_H0);
+      if (read_data == 32'hdeadbeef) begin
+        $display("--- Error: Chaining value written while busy.");
+        error_ctr = error_ctr + 1;
+      end
+
+      $display("--- test4: completed.");
+      $display("");
+    end
+  endtask  // test4
+
+
+  //----------------------------------------------------------------
+  // exit_with_error_code()
+  //
+  // Exit with the right error code
+  //----------------------------------------------------------------
+  task exit_with_error_code;
+    begin
+      if (error_ctr == 0) begin
+        $finish(0);
+      end
+      else begin
+        $fatal(1);
+      end
+    end
+  endtask  // exit_with_error_code
+
+
+  //----------------------------------------------------------------
+  // blake2s_test
+  //----------------------------------------------------------------
+  initial begin : blake2s_test
+    $display("");
+    $display("   -= Testbench for blake2s started =-");
+    $display("     ===============================");
+    $display("");
+
+    init_sim();
+    reset_dut();
+    test1();
+    test2();
+    test3();
+    test4();
+
+    display_test_result();
+    $display("");
+    $display("   -= Testbench for blake2s completed =-");
+    $display("     =================================");
+    $display("");
+    exit_with_error_code();
+  end  // blake2s_test
+endmodule  // tb_blake2s
+
+//======================================================================
+// EOF tb_blake2s.v
+//======================================================================
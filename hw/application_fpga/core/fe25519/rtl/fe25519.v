@@ -0,0 +1,158 @@
+//======================================================================
+//
+// fe25519.v
+// ---------
+// Top level wrapper for the field multiplication core.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module fe25519 (
+    input wire clk,
+    input wire reset_n,
+
+    input  wire          cs,
+    input  wire          we,
+    input  wire [ 7 : 0] address,
+    input  wire [31 : 0] write_data,
+    output wire [31 : 0] read_data,
+    output wire          ready
+);
+
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  localparam ADDR_NAME0 = 8'h00;
+  localparam ADDR_NAME1 = 8'h01;
+  localparam ADDR_VERSION = 8'h02;
+
+  localparam ADDR_CTRL = 8'h08;
+  localparam CTRL_MUL_BIT = 0;
+  localparam CTRL_SQUARE_BIT = 1;
+
+  localparam ADDR_STATUS = 8'h09;
+  localparam STATUS_READY_BIT = 0;
+
+  localparam ADDR_F0 = 8'h10;
+  localparam ADDR_F9 = 8'h19;
+
+  localparam ADDR_G0 = 8'h20;
+  localparam ADDR_G9 = 8'h29;
+
+  localparam ADDR_H0 = 8'h30;
+  localparam ADDR_H9 = 8'h39;
+
+  localparam CORE_NAME0 = 32'h66653235;  // "fe25"
+  localparam CORE_NAME1 = 32'h35313920;  // "519 "
+  localparam CORE_VERSION = 32'h00000001;
+
+
+  //----------------------------------------------------------------
+  // Wires.
+  //----------------------------------------------------------------
+  reg  [31 : 0] tmp_read_data;
+  reg           tmp_ready;
+
+  reg           core_start;
+  reg           f_we;
+  reg           g_we;
+
+  wire [31 : 0] core_h_limb;
+  wire          core_ready;
+
+
+  //----------------------------------------------------------------
+  // Concurrent connectivity for ports etc.
+  //----------------------------------------------------------------
+  assign read_data = tmp_read_data;
+  assign ready     = tmp_ready;
+
+
+  //----------------------------------------------------------------
+  // core instantiation.
+  //----------------------------------------------------------------
+  fe25519_core core (
+      .clk(clk),
+      .reset_n(reset_n),
+
+      .start (core_start),
+      .square(write_data[CTRL_SQUARE_BIT]),
+
+      .f_we(f_we),
+      .g_we(g_we),
+      .limb_addr(address[3 : 0]),
+      .write_data(write_data),
+      .h_limb(core_h_limb),
+
+      .ready(core_ready)
+  );
+
+
+  //----------------------------------------------------------------
+  // api
+  //
+  // The interface command decoding logic. The operands can only be
+  // written while the core is ready. Setting either the MUL or the
+  // SQUARE bit in CTRL starts the core. When squaring, F is used
+  // for both operands.
+  //----------------------------------------------------------------
+  always @* begin : api
+    core_start    = 1'h0;
+    f_we          = 1'h0;
+    g_we          = 1'h0;
+    tmp_read_data = 32'h0;
+    tmp_ready     = 1'h0;
+
+    if (cs) begin
+      tmp_ready = 1'h1;
+
+      if (we) begin
+        if (core_ready) begin
+          if (address == ADDR_CTRL) begin
+            core_start = write_data[CTRL_MUL_BIT] | write_data[CTRL_SQUARE_BIT];
+          end
+
+          if ((address >= ADDR_F0) && (address <= ADDR_F9)) begin
+            f_we = 1'h1;
+          end
+
+          if ((address >= ADDR_G0) && (address <= ADDR_G9)) begin
+            g_we = 1'h1;
+          end
+        end
+      end
+
+      else begin
+        if (address == ADDR_NAME0) begin
+          tmp_read_data = CORE_NAME0;
+        end
+
+        if (address == ADDR_NAME1) begin
+          tmp_read_data = CORE_NAME1;
+        end
+
+        if (address == ADDR_VERSION) begin
+          tmp_read_data = CORE_VERSION;
+        end
+
+        if (address == ADDR_STATUS) begin
+          tmp_read_data[STATUS_READY_BIT] = core_ready;
+        end
+
+        if ((address >= ADDR_H0) && (address <= ADDR_H9)) begin
+          tmp_read_data = core_h_limb;
+        end
+      end
+    end
+  end  // api
+endmodule  // fe25519
+
+//======================================================================
+// EOF fe25519.v
+//======================================================================
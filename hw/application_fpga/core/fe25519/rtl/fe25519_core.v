@@ -0,0 +1,413 @@
+//======================================================================
+//
+// fe25519_core.v
+// --------------
+// Multiplication of field elements mod 2^255 - 19, bit exact with
+// fe_mul() and fe_sq() in Monocypher. The elements are given as ten
+// signed limbs, alternating 26 and 25 bits.
+//
+// One 32x32 bit product is accumulated every cycle. The ten
+// products for each limb of the result are done in order, into a
+// 64 bit sum. The products that wrap around are multiplied by 19,
+// and products of two odd limbs by 2, by scaling the operands. The
+// operands and the product are registered, so the multiplication
+// can be done in the DSPs. The carries are then propagated in the
+// same order as Monocypher does it, one step per cycle. A
+// multiplication takes 114 cycles.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module fe25519_core (
+    input wire clk,
+    input wire reset_n,
+
+    input wire start,
+    input wire square,
+
+    input  wire          f_we,
+    input  wire          g_we,
+    input  wire [ 3 : 0] limb_addr,
+    input  wire [31 : 0] write_data,
+    output wire [31 : 0] h_limb,
+
+    output wire          ready
+);
+
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  localparam CTRL_IDLE = 2'h0;
+  localparam CTRL_MUL = 2'h1;
+  localparam CTRL_DRAIN = 2'h2;
+  localparam CTRL_CARRY = 2'h3;
+
+
+  //----------------------------------------------------------------
+  // Registers including update variables and write enable.
+  //----------------------------------------------------------------
+  reg [31 : 0] f_reg           [0 : 9];
+  reg [31 : 0] g_reg           [0 : 9];
+
+  reg [63 : 0] t_reg           [0 : 9];
+
+  reg          square_reg;
+  reg          square_we;
+
+  reg [31 : 0] op_a_reg;
+  reg [31 : 0] op_a_new;
+  reg [31 : 0] op_b_reg;
+  reg [31 : 0] op_b_new;
+  reg          op_valid_reg;
+  reg          op_valid_new;
+  reg          op_first_reg;
+  reg          op_last_reg;
+  reg [ 3 : 0] op_limb_reg;
+
+  reg [63 : 0] p_reg;
+  reg          p_valid_reg;
+  reg          p_first_reg;
+  reg          p_last_reg;
+  reg [ 3 : 0] p_limb_reg;
+
+  reg [63 : 0] acc_reg;
+  reg [63 : 0] acc_new;
+
+  reg [ 3 : 0] k_ctr_reg;
+  reg [ 3 : 0] k_ctr_new;
+  reg          k_ctr_we;
+
+  reg [ 3 : 0] i_ctr_reg;
+  reg [ 3 : 0] i_ctr_new;
+  reg          i_ctr_we;
+
+  reg [ 3 : 0] step_ctr_reg;
+  reg [ 3 : 0] step_ctr_new;
+  reg          step_ctr_we;
+
+  reg          ready_reg;
+  reg          ready_new;
+  reg          ready_we;
+
+  reg [ 1 : 0] fe25519_ctrl_reg;
+  reg [ 1 : 0] fe25519_ctrl_new;
+  reg          fe25519_ctrl_we;
+
+
+  //----------------------------------------------------------------
+  // Wires.
+  //----------------------------------------------------------------
+  reg          carry_step;
+  reg [ 3 : 0] carry_src;
+  reg [ 3 : 0] carry_dst;
+  reg [63 : 0] carry_src_new;
+  reg [63 : 0] carry_dst_new;
+
+
+  //----------------------------------------------------------------
+  // Concurrent connectivity for ports etc.
+  //----------------------------------------------------------------
+  assign h_limb = t_reg[limb_addr][31 : 0];
+
+  assign ready  = ready_reg;
+
+
+  //----------------------------------------------------------------
+  // reg_update
+  //----------------------------------------------------------------
+  always @(posedge clk) begin : reg_update
+    integer i;
+
+    if (!reset_n) begin
+      for (i = 0; i < 10; i = i + 1) begin
+        f_reg[i] <= 32'h0;
+        g_reg[i] <= 32'h0;
+        t_reg[i] <= 64'h0;
+      end
+
+      square_reg       <= 1'h0;
+      op_a_reg         <= 32'h0;
+      op_b_reg         <= 32'h0;
+      op_valid_reg     <= 1'h0;
+      op_first_reg     <= 1'h0;
+      op_last_reg      <= 1'h0;
+      op_limb_reg      <= 4'h0;
+      p_reg            <= 64'h0;
+      p_valid_reg      <= 1'h0;
+      p_first_reg      <= 1'h0;
+      p_last_reg       <= 1'h0;
+      p_limb_reg       <= 4'h0;
+      acc_reg          <= 64'h0;
+      k_ctr_reg        <= 4'h0;
+      i_ctr_reg        <= 4'h0;
+      step_ctr_reg     <= 4'h0;
+      ready_reg        <= 1'h1;
+      fe25519_ctrl_reg <= CTRL_IDLE;
+    end
+
+    else begin
+      op_a_reg     <= op_a_new;
+      op_b_reg     <= op_b_new;
+      op_valid_reg <= op_valid_new;
+      op_first_reg <= (i_ctr_reg == 4'h0);
+      op_last_reg  <= (i_ctr_reg == 4'h9);
+      op_limb_reg  <= k_ctr_reg;
+
+      p_reg        <= $signed(op_a_reg) * $signed(op_b_reg);
+      p_valid_reg  <= op_valid_reg;
+      p_first_reg  <= op_first_reg;
+      p_last_reg   <= op_last_reg;
+      p_limb_reg   <= op_limb_reg;
+
+      if (p_valid_reg) begin
+        acc_reg <= acc_new;
+
+        if (p_last_reg) begin
+          t_reg[p_limb_reg] <= acc_new;
+        end
+      end
+
+      if (carry_step) begin
+        t_reg[carry_src] <= carry_src_new;
+        t_reg[carry_dst] <= carry_dst_new;
+      end
+
+      if (f_we) begin
+        f_reg[limb_addr] <= write_data;
+      end
+
+      if (g_we) begin
+        g_reg[limb_addr] <= write_data;
+      end
+
+      if (square_we) begin
+        square_reg <= square;
+      end
+
+      if (k_ctr_we) begin
+        k_ctr_reg <= k_ctr_new;
+      end
+
+      if (i_ctr_we) begin
+        i_ctr_reg <= i_ctr_new;
+      end
+
+      if (step_ctr_we) begin
+        step_ctr_reg <= step_ctr_new;
+      end
+
+      if (ready_we) begin
+        ready_reg <= ready_new;
+      end
+
+      if (fe25519_ctrl_we) begin
+        fe25519_ctrl_reg <= fe25519_ctrl_new;
+      end
+    end
+  end  // reg_update
+
+
+  //----------------------------------------------------------------
+  // operand_logic
+  //
+  // Limb k of the result is the sum of f[i] * g[j] where i + j is
+  // k or k + 10. In the second case the product wraps around and
+  // is multiplied by 19. Products of two odd limbs are multiplied
+  // by 2, since the odd limbs are worth half a bit less.
+  //----------------------------------------------------------------
+  always @* begin : operand_logic
+    reg          wrap;
+    reg [ 3 : 0] j;
+    reg [31 : 0] f_limb;
+    reg [31 : 0] g_limb;
+
+    wrap = k_ctr_reg < i_ctr_reg;
+
+    if (wrap) begin
+      j = k_ctr_reg + 4'ha - i_ctr_reg;
+    end
+    else begin
+      j = k_ctr_reg - i_ctr_reg;
+    end
+
+    f_limb = f_reg[i_ctr_reg];
+
+    if (square_reg) begin
+      g_limb = f_reg[j];
+    end
+    else begin
+      g_limb = g_reg[j];
+    end
+
+    if (i_ctr_reg[0] && j[0]) begin
+      op_a_new = {f_limb[30 : 0], 1'h0};
+    end
+    else begin
+      op_a_new = f_limb;
+    end
+
+    if (wrap) begin
+      op_b_new = {g_limb[27 : 0], 4'h0} + {g_limb[30 : 0], 1'h0} + g_limb;
+    end
+    else begin
+      op_b_new = g_limb;
+    end
+  end  // operand_logic
+
+
+  //----------------------------------------------------------------
+  // acc_logic
+  //----------------------------------------------------------------
+  always @* begin : acc_logic
+    if (p_first_reg) begin
+      acc_new = p_reg;
+    end
+    else begin
+      acc_new = acc_reg + p_reg;
+    end
+  end  // acc_logic
+
+
+  //----------------------------------------------------------------
+  // carry_logic
+  //
+  // One step of the carry propagation. The carry c is the limb
+  // rounded to its width. It is subtracted from the limb and added
+  // to the next one. The carry from the last limb wraps around to
+  // the first and is multiplied by 19.
+  //----------------------------------------------------------------
+  always @* begin : carry_logic
+    reg          wide;
+    reg          wrap;
+    reg [63 : 0] src;
+    reg [63 : 0] c;
+
+    case (step_ctr_reg)
+      4'h0: {carry_src, carry_dst} = {4'h0, 4'h1};
+      4'h1: {carry_src, carry_dst} = {4'h4, 4'h5};
+      4'h2: {carry_src, carry_dst} = {4'h1, 4'h2};
+      4'h3: {carry_src, carry_dst} = {4'h5, 4'h6};
+      4'h4: {carry_src, carry_dst} = {4'h2, 4'h3};
+      4'h5: {carry_src, carry_dst} = {4'h6, 4'h7};
+      4'h6: {carry_src, carry_dst} = {4'h3, 4'h4};
+      4'h7: {carry_src, carry_dst} = {4'h7, 4'h8};
+      4'h8: {carry_src, carry_dst} = {4'h4, 4'h5};
+      4'h9: {carry_src, carry_dst} = {4'h8, 4'h9};
+      4'ha: {carry_src, carry_dst} = {4'h9, 4'h0};
+      default: {carry_src, carry_dst} = {4'h0, 4'h1};
+    endcase
+
+    // Even limbs are 26 bits wide, odd limbs 25 bits.
+    wide = ~carry_src[0];
+    wrap = carry_src == 4'h9;
+    src  = t_reg[carry_src];
+
+    if (wide) begin
+      c             = $signed(src + 64'h0000000002000000) >>> 26;
+      carry_src_new = src - {c[37 : 0], 26'h0};
+    end
+    else begin
+      c             = $signed(src + 64'h0000000001000000) >>> 25;
+      carry_src_new = src - {c[38 : 0], 25'h0};
+    end
+
+    if (wrap) begin
+      carry_dst_new = t_reg[carry_dst] + {c[59 : 0], 4'h0} + {c[62 : 0], 1'h0} + c;
+    end
+    else begin
+      carry_dst_new = t_reg[carry_dst] + c;
+    end
+  end  // carry_logic
+
+
+  //----------------------------------------------------------------
+  // fe25519_ctrl
+  //----------------------------------------------------------------
+  always @* begin : fe25519_ctrl
+    op_valid_new     = 1'h0;
+    carry_step       = 1'h0;
+    square_we        = 1'h0;
+    k_ctr_new        = 4'h0;
+    k_ctr_we         = 1'h0;
+    i_ctr_new        = 4'h0;
+    i_ctr_we         = 1'h0;
+    step_ctr_new     = 4'h0;
+    step_ctr_we      = 1'h0;
+    ready_new        = 1'h0;
+    ready_we         = 1'h0;
+    fe25519_ctrl_new = CTRL_IDLE;
+    fe25519_ctrl_we  = 1'h0;
+
+    case (fe25519_ctrl_reg)
+      CTRL_IDLE: begin
+        if (start) begin
+          square_we        = 1'h1;
+          k_ctr_we         = 1'h1;
+          i_ctr_we         = 1'h1;
+          ready_new        = 1'h0;
+          ready_we         = 1'h1;
+          fe25519_ctrl_new = CTRL_MUL;
+          fe25519_ctrl_we  = 1'h1;
+        end
+      end
+
+      CTRL_MUL: begin
+        op_valid_new = 1'h1;
+        i_ctr_new    = i_ctr_reg + 1'h1;
+        i_ctr_we     = 1'h1;
+
+        if (i_ctr_reg == 4'h9) begin
+          i_ctr_new = 4'h0;
+          k_ctr_new = k_ctr_reg + 1'h1;
+          k_ctr_we  = 1'h1;
+
+          if (k_ctr_reg == 4'h9) begin
+            step_ctr_new     = 4'h0;
+            step_ctr_we      = 1'h1;
+            fe25519_ctrl_new = CTRL_DRAIN;
+            fe25519_ctrl_we  = 1'h1;
+          end
+        end
+      end
+
+      CTRL_DRAIN: begin
+        // Wait for the last products to be accumulated. The step
+        // counter counts the cycles.
+        step_ctr_new = step_ctr_reg + 1'h1;
+        step_ctr_we  = 1'h1;
+
+        if (step_ctr_reg == 4'h1) begin
+          step_ctr_new     = 4'h0;
+          fe25519_ctrl_new = CTRL_CARRY;
+          fe25519_ctrl_we  = 1'h1;
+        end
+      end
+
+      CTRL_CARRY: begin
+        carry_step   = 1'h1;
+        step_ctr_new = step_ctr_reg + 1'h1;
+        step_ctr_we  = 1'h1;
+
+        if (step_ctr_reg == 4'hb) begin
+          ready_new        = 1'h1;
+          ready_we         = 1'h1;
+          fe25519_ctrl_new = CTRL_IDLE;
+          fe25519_ctrl_we  = 1'h1;
+        end
+      end
+
+      default: begin
+      end
+    endcase
+  end  // fe25519_ctrl
+endmodule  // fe25519_core
+
+//======================================================================
+// EOF fe25519_core.v
+//======================================================================
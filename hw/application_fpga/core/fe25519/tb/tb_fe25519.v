@@ -0,0 +1,618 @@
+//======================================================================
+//
+// tb_fe25519.v
+// ------------
+// Testbench for the field multiplication core. The test vectors
+// were computed with fe_mul() and fe_sq() in Monocypher.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module tb_fe25519 ();
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  parameter DEBUG = 0;
+
+  parameter CLK_HALF_PERIOD = 1;
+  parameter CLK_PERIOD = 2 * CLK_HALF_PERIOD;
+
+  localparam ADDR_NAME0 = 8'h00;
+  localparam ADDR_NAME1 = 8'h01;
+  localparam ADDR_VERSION = 8'h02;
+
+  localparam ADDR_CTRL = 8'h08;
+  localparam CTRL_MUL_BIT = 0;
+  localparam CTRL_SQUARE_BIT = 1;
+
+  localparam ADDR_STATUS = 8'h09;
+  localparam STATUS_READY_BIT = 0;
+
+  localparam ADDR_F0 = 8'h10;
+  localparam ADDR_G0 = 8'h20;
+  localparam ADDR_H0 = 8'h30;
+
+  // Documented latency of a multiplication, and the slack the status
+  // polling in the tb adds around it.
+  localparam MUL_CYCLES = 114;
+  localparam POLL_SLACK = 2;
+
+
+  //----------------------------------------------------------------
+  // Register and Wire declarations.
+  //----------------------------------------------------------------
+  reg  [ 31 : 0] cycle_ctr;
+  reg  [ 31 : 0] error_ctr;
+  reg  [ 31 : 0] tc_ctr;
+  reg            tb_monitor;
+
+  reg            tb_clk;
+  reg            tb_reset_n;
+  reg            tb_cs;
+  reg            tb_we;
+  reg  [  7 : 0] tb_address;
+  reg  [ 31 : 0] tb_write_data;
+  wire [ 31 : 0] tb_read_data;
+  wire           tb_ready;
+
+  reg  [ 31 : 0] read_data;
+  reg  [319 : 0] result;
+
+
+  //----------------------------------------------------------------
+  // Device Under Test.
+  //----------------------------------------------------------------
+  fe25519 dut (
+      .clk(tb_clk),
+      .reset_n(tb_reset_n),
+
+      .cs(tb_cs),
+      .we(tb_we),
+      .address(tb_address),
+      .write_data(tb_write_data),
+      .read_data(tb_read_data),
+      .ready(tb_ready)
+  );
+
+
+  //----------------------------------------------------------------
+  // clk_gen
+  //
+  // Always running clock generator process.
+  //----------------------------------------------------------------
+  always begin : clk_gen
+    #CLK_HALF_PERIOD;
+    tb_clk = !tb_clk;
+  end  // clk_gen
+
+
+  //----------------------------------------------------------------
+  // sys_monitor()
+  //
+  // An always running process that creates a cycle counter and
+  // conditionally displays information about the DUT.
+  //----------------------------------------------------------------
+  always begin : sys_monitor
+    cycle_ctr = cycle_ctr + 1;
+    #(CLK_PERIOD);
+    if (tb_monitor) begin
+      dump_dut_state();
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // dump_dut_state()
+  //
+  // Dump the state of the dump when needed.
+  //----------------------------------------------------------------
+  task dump_dut_state;
+    begin
+      $display("State of DUT");
+      $display("------------");
+      $display("Cycle: %08d", cycle_ctr);
+      $display("");
+      $display("Inputs and outputs:");
+      $display(
+          "cs: 0x%1x, we: 0x%1x, address: 0x%02x, write_data: 0x%08x, read_data: 0x%08x, ready: 0x%1x",
+          tb_cs, tb_we, tb_address, tb_write_data, tb_read_data, tb_ready);
+      $display("");
+      $display("Internal state:");
+      $display("ctrl: 0x%1x, k: 0x%1x, i: 0x%1x, step: 0x%1x, ready: 0x%1x",
+               dut.core.fe25519_ctrl_reg, dut.core.k_ctr_reg, dut.core.i_ctr_reg,
+               dut.core.step_ctr_reg, dut.core.ready_reg);
+      $display("op_a: 0x%08x, op_b: 0x%08x, p: 0x%016x, acc: 0x%016x", dut.core.op_a_reg,
+               dut.core.op_b_reg, dut.core.p_reg, dut.core.acc_reg);
+      $display("");
+      $display("");
+    end
+  endtask  // dump_dut_state
+
+
+  //----------------------------------------------------------------
+  // reset_dut()
+  //
+  // Toggle reset to put the DUT into a well known state.
+  //----------------------------------------------------------------
+  task reset_dut;
+    begin
+      $display("--- Toggle reset.");
+      tb_reset_n = 0;
+      #(2 * CLK_PERIOD);
+      tb_reset_n = 1;
+    end
+  endtask  // reset_dut
+
+
+  //----------------------------------------------------------------
+  // display_test_result()
+  //
+  // Display the accumulated test results.
+  //----------------------------------------------------------------
+  task display_test_result;
+    begin
+      if (error_ctr == 0) begin
+        $display("--- All %02d test cases completed successfully", tc_ctr);
+      end
+      else begin
+        $display("--- %02d tests completed - %02d test cases did not complete successfully.",
+                 tc_ctr, error_ctr);
+      end
+    end
+  endtask  // display_test_result
+
+
+  //----------------------------------------------------------------
+  // init_sim()
+  //
+  // Initialize all counters and testbed functionality as well
+  // as setting the DUT inputs to defined values.
+  //----------------------------------------------------------------
+  task init_sim;
+    begin
+      cycle_ctr     = 0;
+      error_ctr     = 0;
+      tc_ctr        = 0;
+      tb_monitor    = 0;
+
+      tb_clk        = 1'h0;
+      tb_reset_n    = 1'h1;
+      tb_cs         = 1'h0;
+      tb_we         = 1'h0;
+      tb_address    = 8'h0;
+      tb_write_data = 32'h0;
+    end
+  endtask  // init_sim
+
+
+  //----------------------------------------------------------------
+  // write_word()
+  //
+  // Write the given word to the DUT using the DUT interface.
+  //----------------------------------------------------------------
+  task write_word(input [7 : 0] address, input [31 : 0] word);
+    begin
+      if (DEBUG) begin
+        $display("--- Writing 0x%08x to 0x%02x.", word, address);
+        $display("");
+      end
+
+      tb_address = address;
+      tb_write_data = word;
+      tb_cs = 1;
+      tb_we = 1;
+      #(CLK_PERIOD);
+      tb_cs = 0;
+      tb_we = 0;
+    end
+  endtask  // write_word
+
+
+  //----------------------------------------------------------------
+  // read_word()
+  //
+  // Read a data word from the given address in the DUT.
+  // the word read will be available in the global variable
+  // read_data.
+  //----------------------------------------------------------------
+  task read_word(input [7 : 0] address);
+    begin
+      tb_address = address;
+      tb_cs = 1;
+      tb_we = 0;
+      #(CLK_PERIOD);
+      read_data = tb_read_data;
+      tb_cs = 0;
+
+      if (DEBUG) begin
+        $display("--- Reading 0x%08x from 0x%02x.", read_data, address);
+        $display("");
+      end
+    end
+  endtask  // read_word
+
+
+  //----------------------------------------------------------------
+  // check_word()
+  //
+  // Read a word and compare it to the expected value.
+  //----------------------------------------------------------------
+  task check_word(input [7 : 0] address, input [31 : 0] expected);
+    begin
+      read_word(address);
+      if (read_data != expected) begin
+        $display("--- Error: Got 0x%08x from 0x%02x, expected 0x%08x.", read_data, address,
+                 expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_word
+
+
+  //----------------------------------------------------------------
+  // wait_ready()
+  //
+  // Wait for the ready flag to be set in dut.
+  //----------------------------------------------------------------
+  task wait_ready;
+    begin : wready
+      read_word(ADDR_STATUS);
+      while (read_data[STATUS_READY_BIT] == 0) read_word(ADDR_STATUS);
+    end
+  endtask  // wait_ready
+
+
+  //----------------------------------------------------------------
+  // write_fe()
+  //
+  // Write the ten limbs of a field element, the first limb first,
+  // starting at the given address.
+  //----------------------------------------------------------------
+  task write_fe(input [7 : 0] address, input [319 : 0] fe);
+    begin : write_fe
+      integer i;
+
+      for (i = 0; i < 10; i = i + 1) begin
+        write_word(address + i[7 : 0], fe[(319-i*32)-:32]);
+      end
+    end
+  endtask  // write_fe
+
+
+  //----------------------------------------------------------------
+  // read_result()
+  //
+  // Read the ten limbs of the result into result.
+  //----------------------------------------------------------------
+  task read_result;
+    begin : read_result
+      integer i;
+
+      for (i = 0; i < 10; i = i + 1) begin
+        read_word(ADDR_H0 + i[7 : 0]);
+        result[(319-i*32)-:32] = read_data;
+      end
+    end
+  endtask  // read_result
+
+
+  //----------------------------------------------------------------
+  // run_core()
+  //
+  // Start the core with the given control word, wait for it and
+  // read the result.
+  //----------------------------------------------------------------
+  task run_core(input [31 : 0] ctrl);
+    begin
+      write_word(ADDR_CTRL, ctrl);
+      wait_ready();
+      read_result();
+    end
+  endtask  // run_core
+
+
+  //----------------------------------------------------------------
+  // check_result()
+  //----------------------------------------------------------------
+  task check_result(input [319 : 0] expected);
+    begin
+      if (result == expected) begin
+        $display("--- Correct result.");
+      end
+      else begin
+        $display("--- Error: Got result 0x%080x", result);
+        $display("--- expected 0x%080x", expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_result
+
+
+  //----------------------------------------------------------------
+  // check_mul()
+  //
+  // Multiply f and g and check the result.
+  //----------------------------------------------------------------
+  task check_mul(input [319 : 0] f, input [319 : 0] g, input [319 : 0] expected);
+    begin
+      write_fe(ADDR_F0, f);
+      write_fe(ADDR_G0, g);
+      run_core(32'h1 << CTRL_MUL_BIT);
+      check_result(expected);
+    end
+  endtask  // check_mul
+
+
+  //----------------------------------------------------------------
+  // check_square()
+  //
+  // Square f and check the result.
+  //----------------------------------------------------------------
+  task check_square(input [319 : 0] f, input [319 : 0] expected);
+    begin
+      write_fe(ADDR_F0, f);
+      run_core(32'h1 << CTRL_SQUARE_BIT);
+      check_result(expected);
+    end
+  endtask  // check_square
+
+
+  //----------------------------------------------------------------
+  // test1()
+  // Read the name and version of the core.
+  //----------------------------------------------------------------
+  task test1;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test1: started.");
+
+      check_word(ADDR_NAME0, 32'h66653235);
+      check_word(ADDR_NAME1, 32'h35313920);
+      check_word(ADDR_VERSION, 32'h00000001);
+      check_word(ADDR_STATUS, 32'h00000001);
+
+      $display("--- test1: completed.");
+      $display("");
+    end
+  endtask  // test1
+
+
+  //----------------------------------------------------------------
+  // test2()
+  // Multiplications, with limbs of both signs.
+  //----------------------------------------------------------------
+  task test2;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test2: started.");
+
+      check_mul(
+          {
+            32'hffc50121, 32'h00b43454, 32'hfe84b643, 32'h0051be5c, 32'hfec7d6ba,
+            32'hff910809, 32'h01dc998d, 32'hff3e49fd, 32'h01be4a53, 32'h00515cfb
+          },
+          {
+            32'h00e02814, 32'hffb8bebd, 32'hff5e20f0, 32'hffb93a19, 32'h015117a7,
+            32'hff3b85ad, 32'hfe6ae65a, 32'h009a9a97, 32'hfed8dd35, 32'hff1c009a
+          },
+          {
+            32'h0022c204, 32'h00bb1b2e, 32'h00d81080, 32'hff7e3b87, 32'h018bbd09,
+            32'h00921545, 32'hfee8b6fc, 32'hff2016aa, 32'hffa9aed9, 32'h00b3aee6
+          });
+
+      check_mul(
+          {
+            32'hfd132e86, 32'hff782148, 32'hfe3c30c6, 32'hffcb8a4c, 32'hfd89517a,
+            32'h00c33ed0, 32'h002705db, 32'hff2b1e23, 32'hfdfc86ff, 32'h00064748
+          },
+          {
+            32'hff90e19b, 32'h00282f3e, 32'hfe776149, 32'hff850f57, 32'h00359462,
+            32'h00711179, 32'hffad0c48, 32'h00d554cb, 32'h01c409dc, 32'h00b66b5b
+          },
+          {
+            32'h013ce569, 32'hffb8e355, 32'hfed21b77, 32'hff88cf0b, 32'h00e3482d,
+            32'hff9cf36f, 32'hff502836, 32'h00044a71, 32'hff6e4796, 32'hff8c0b52
+          });
+
+      check_mul(
+          {
+            32'hffa422bb, 32'hffb2a900, 32'h00bce659, 32'h00a8b4a3, 32'hff613e60,
+            32'h009e45af, 32'h01fc90dc, 32'hff2e4366, 32'h01750120, 32'hff3c9cbf
+          },
+          {
+            32'hfd3165df, 32'h002b82c2, 32'hff6ddf76, 32'hfe9bcd00, 32'hffcccbba,
+            32'h00efc5a6, 32'hfedf997b, 32'h01af6f77, 32'hfef55a4a, 32'h01815154
+          },
+          {
+            32'h00013b8c, 32'hfffc2c69, 32'h013f5611, 32'h0020bc70, 32'h008f758b,
+            32'h0034b771, 32'h00fca5de, 32'hffc61f71, 32'hfff5d2f4, 32'h00c87ec8
+          });
+
+      check_mul(
+          {
+            32'hfeaa9ec6, 32'hff5d231a, 32'hff61673d, 32'hfe710eba, 32'hff6f3845,
+            32'h00eacec6, 32'hfe935513, 32'h009290b8, 32'hfff3990a, 32'hffa8c709
+          },
+          {
+            32'hfc4e7fbf, 32'hff974ab8, 32'hfec1d59c, 32'hffc41061, 32'hfe9cc5bd,
+            32'h004575cc, 32'hff61eb0f, 32'h00306673, 32'hfe8339c0, 32'h006dc857
+          },
+          {
+            32'h004b5772, 32'h00848046, 32'hfe0f25f1, 32'h00ce7354, 32'h01a624ae,
+            32'hffafd3b9, 32'h01e4ea90, 32'h00b591fe, 32'hff7bf8e1, 32'h007916b8
+          });
+
+      $display("--- test2: completed.");
+      $display("");
+    end
+  endtask  // test2
+
+
+  //----------------------------------------------------------------
+  // test3()
+  // Squarings of the same elements. Also checks that the square
+  // bit isn't left set for the next multiplication.
+  //----------------------------------------------------------------
+  task test3;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test3: started.");
+
+      check_square(
+          {
+            32'hffc50121, 32'h00b43454, 32'hfe84b643, 32'h0051be5c, 32'hfec7d6ba,
+            32'hff910809, 32'h01dc998d, 32'hff3e49fd, 32'h01be4a53, 32'h00515cfb
+          },
+          {
+            32'h000bca49, 32'h00b26f3c, 32'h00b1ff4e, 32'hff9e1f19, 32'h00ef6d4d,
+            32'h00f7cb44, 32'h00824990, 32'hff2e4cec, 32'h005af110, 32'hff79d17f
+          });
+
+      check_square(
+          {
+            32'hfd132e86, 32'hff782148, 32'hfe3c30c6, 32'hffcb8a4c, 32'hfd89517a,
+            32'h00c33ed0, 32'h002705db, 32'hff2b1e23, 32'hfdfc86ff, 32'h00064748
+          },
+          {
+            32'hffa52bcf, 32'hff991476, 32'h0002da8b, 32'hffbb9c11, 32'hffcee614,
+            32'hffd99a6a, 32'hffd43c93, 32'hff096867, 32'h0034b0a7, 32'hff155596
+          });
+
+      check_square(
+          {
+            32'hffa422bb, 32'hffb2a900, 32'h00bce659, 32'h00a8b4a3, 32'hff613e60,
+            32'h009e45af, 32'h01fc90dc, 32'hff2e4366, 32'h01750120, 32'hff3c9cbf
+          },
+          {
+            32'hfe9d79fb, 32'hffc9f49f, 32'h000feee7, 32'h00b9656d, 32'hfed0504d,
+            32'hffad5619, 32'hffe54e0a, 32'h00ef400d, 32'hff255b03, 32'hffe4af25
+          });
+
+      check_square(
+          {
+            32'hfeaa9ec6, 32'hff5d231a, 32'hff61673d, 32'hfe710eba, 32'hff6f3845,
+            32'h00eacec6, 32'hfe935513, 32'h009290b8, 32'hfff3990a, 32'hffa8c709
+          },
+          {
+            32'h00e3526d, 32'hff101ae4, 32'h005115dc, 32'hff273866, 32'hffac9a5f,
+            32'h005b9fdf, 32'h011a8645, 32'hff3e00fe, 32'h01919238, 32'hffd27dc4
+          });
+
+      run_core(32'h1 << CTRL_MUL_BIT);
+      check_result(
+          {
+            32'h004b5772, 32'h00848046, 32'hfe0f25f1, 32'h00ce7354, 32'h01a624ae,
+            32'hffafd3b9, 32'h01e4ea90, 32'h00b591fe, 32'hff7bf8e1, 32'h007916b8
+          });
+
+      $display("--- test3: completed.");
+      $display("");
+    end
+  endtask  // test3
+
+
+  //----------------------------------------------------------------
+  // test4()
+  // Check that the operands can't be changed while the core is
+  // busy, and that a multiplication takes the documented number of
+  // cycles.
+  //----------------------------------------------------------------
+  task test4;
+    begin : test4
+      reg [31 : 0] start_cycle;
+      reg [31 : 0] cycles;
+
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test4: started.");
+
+      write_word(ADDR_CTRL, 32'h1 << CTRL_MUL_BIT);
+      start_cycle = cycle_ctr;
+      check_word(ADDR_STATUS, 32'h0);
+      write_word(ADDR_F0, 32'hdeadbeef);
+      wait_ready();
+      cycles = cycle_ctr - start_cycle;
+      $display("--- test4: One multiplication in %0d cycles.", cycles);
+
+      if ((cycles + POLL_SLACK < MUL_CYCLES) || (cycles > MUL_CYCLES + POLL_SLACK)) begin
+        $display("--- Error: Expected %0d cycles per multiplication.", MUL_CYCLES);
+        error_ctr = error_ctr + 1;
+      end
+
+      read_result();
+      check_result(
+          {
+            32'h004b5772, 32'h00848046, 32'hfe0f25f1, 32'h00ce7354, 32'h01a624ae,
+            32'hffafd3b9, 32'h01e4ea90, 32'h00b591fe, 32'hff7bf8e1, 32'h007916b8
+          });
+      run_core(32'h1 << CTRL_MUL_BIT);
+      check_result(
+          {
+            32'h004b5772, 32'h00848046, 32'hfe0f25f1, 32'h00ce7354, 32'h01a624ae,
+            32'hffafd3b9, 32'h01e4ea90, 32'h00b591fe, 32'hff7bf8e1, 32'h007916b8
+          });
+
+      $display("--- test4: completed.");
+      $display("");
+    end
+  endtask  // test4
+
+
+  //----------------------------------------------------------------
+  // exit_with_error_code()
+  //
+  // Exit with the right error code
+  //----------------------------------------------------------------
+  task exit_with_error_code;
+    begin
+      if (error_ctr == 0) begin
+        $finish(0);
+      end
+      else begin
+        $fatal(1);
+      end
+    end
+  endtask  // exit_with_error_code
+
+
+  //----------------------------------------------------------------
+  // fe25519_test
+  //----------------------------------------------------------------
+  initial begin : fe25519_test
+    $display("");
+    $display("   -= Testbench for fe25519 started =-");
+    $display("     ==============================");
+    $display("");
+
+    init_sim();
+    reset_dut();
+    test1();
+    test2();
+    test3();
+    test4();
+
+    display_test_result();
+    $display("");
+    $display("   -= Testbench for fe25519 completed =-");
+    $display("     ================================");
+    $display("");
+    exit_with_error_code();
+  end  // fe25519_test
+endmodule  // tb_fe25519
+
+//======================================================================
+// EOF tb_fe25519.v
+//======================================================================
@@ -7,7 +7,8 @@
 // 128 kByte large memory.
 //
 // The block also implements data and address scrambling controlled
-// by the ram_addr_rand and ram_data_rand seeds.
+// by the ram_addr_rand and ram_data_rand seeds, and an engine that
+// fills the whole memory with pseudo random data.
 //
 //
 // Author: Joachim Strombergson
@@ -25,6 +26,12 @@ module ram (
     input wire [14 : 0] ram_addr_rand,
     input wire [31 : 0] ram_data_rand,
 
+    input  wire [31 : 0] fill_data,
+    input  wire          fill_state_we,
+    input  wire          fill_acc_we,
+    input  wire          fill_start,
+    output wire          fill_busy,
+
     input  wire          cs,
     input  wire [ 3 : 0] we,
     input  wire [15 : 0] address,
@@ -39,8 +46,18 @@ module ram (
   //----------------------------------------------------------------
   reg          ready_reg;
 
+  reg [31 : 0] fill_state_reg;
+  reg [31 : 0] fill_state_new;
+  reg [31 : 0] fill_acc_reg;
+  reg [14 : 0] fill_addr_reg;
+  reg          fill_busy_reg;
+  reg          fill_next;
+
   reg          cs0;
   reg          cs1;
+  reg [ 3 : 0] spram_we;
+  reg [13 : 0] spram_addr;
+  reg [31 : 0] spram_write_data;
   reg [31 : 0] read_data0;
   reg [31 : 0] read_data1;
   reg [31 : 0] muxed_read_data;
@@ -55,16 +72,17 @@ module ram (
   //----------------------------------------------------------------
   assign read_data = descrambled_read_data;
   assign ready     = ready_reg;
+  assign fill_busy = fill_busy_reg;
 
 
   //----------------------------------------------------------------
   // SPRAM instances.
   //----------------------------------------------------------------
   SB_SPRAM256KA spram0 (
-      .ADDRESS(scrambled_ram_addr[13:0]),
-      .DATAIN(scrambled_write_data[15:0]),
-      .MASKWREN({we[1], we[1], we[0], we[0]}),
-      .WREN(we[1] | we[0]),
+      .ADDRESS(spram_addr),
+      .DATAIN(spram_write_data[15:0]),
+      .MASKWREN({spram_we[1], spram_we[1], spram_we[0], spram_we[0]}),
+      .WREN(spram_we[1] | spram_we[0]),
       .CHIPSELECT(cs0),
       .CLOCK(clk),
       .STANDBY(1'b0),
@@ -74,10 +92,10 @@ module ram (
   );
 
   SB_SPRAM256KA spram1 (
-      .ADDRESS(scrambled_ram_addr[13:0]),
-      .DATAIN(scrambled_write_data[31:16]),
-      .MASKWREN({we[3], we[3], we[2], we[2]}),
-      .WREN(we[3] | we[2]),
+      .ADDRESS(spram_addr),
+      .DATAIN(spram_write_data[31:16]),
+      .MASKWREN({spram_we[3], spram_we[3], spram_we[2], spram_we[2]}),
+      .WREN(spram_we[3] | spram_we[2]),
       .CHIPSELECT(cs0),
       .CLOCK(clk),
       .STANDBY(1'b0),
@@ -88,10 +106,10 @@ module ram (
 
 
   SB_SPRAM256KA spram2 (
-      .ADDRESS(scrambled_ram_addr[13:0]),
-      .DATAIN(scrambled_write_data[15:0]),
-      .MASKWREN({we[1], we[1], we[0], we[0]}),
-      .WREN(we[1] | we[0]),
+      .ADDRESS(spram_addr),
+      .DATAIN(spram_write_data[15:0]),
+      .MASKWREN({spram_we[1], spram_we[1], spram_we[0], spram_we[0]}),
+      .WREN(spram_we[1] | spram_we[0]),
       .CHIPSELECT(cs1),
       .CLOCK(clk),
       .STANDBY(1'b0),
@@ -101,10 +119,10 @@ module ram (
   );
 
   SB_SPRAM256KA spram3 (
-      .ADDRESS(scrambled_ram_addr[13:0]),
-      .DATAIN(scrambled_write_data[31:16]),
-      .MASKWREN({we[3], we[3], we[2], we[2]}),
-      .WREN(we[3] | we[2]),
+      .ADDRESS(spram_addr),
+      .DATAIN(spram_write_data[31:16]),
+      .MASKWREN({spram_we[3], spram_we[3], spram_we[2], spram_we[2]}),
+      .WREN(spram_we[3] | spram_we[2]),
       .CHIPSELECT(cs1),
       .CLOCK(clk),
       .STANDBY(1'b0),
@@ -118,15 +136,40 @@ module ram (
   // reg_update
   //
   // Posedge triggered with synchronous, active low reset.
-  // This simply creates a one cycle access latency to match
+  // The ready flag creates a one cycle access latency to match
   // the latency of the spram blocks.
   //----------------------------------------------------------------
   always @(posedge clk) begin : reg_update
     if (!reset_n) begin
-      ready_reg <= 1'h0;
+      ready_reg      <= 1'h0;
+      fill_state_reg <= 32'h0;
+      fill_acc_reg   <= 32'h0;
+      fill_addr_reg  <= 15'h0;
+      fill_busy_reg  <= 1'h0;
     end
     else begin
       ready_reg <= cs;
+
+      if (fill_state_we) begin
+        fill_state_reg <= fill_data;
+      end
+
+      if (fill_acc_we) begin
+        fill_acc_reg <= fill_data;
+      end
+
+      if (fill_start) begin
+        fill_addr_reg <= 15'h0;
+        fill_busy_reg <= 1'h1;
+      end
+      else if (fill_next) begin
+        fill_state_reg <= fill_state_new;
+        fill_addr_reg  <= fill_addr_reg + 1'h1;
+
+        if (fill_addr_reg == 15'h7fff) begin
+          fill_busy_reg <= 1'h0;
+        end
+      end
     end
   end
 
@@ -144,15 +187,49 @@ module ram (
   end
 
 
+  //----------------------------------------------------------------
+  // fill_prng
+  //
+  // The next fill word from an xorwow generator, the same one
+  // the firmware used to fill the RAM with in software.
+  //----------------------------------------------------------------
+  always @* begin : fill_prng
+    reg [31 : 0] x;
+
+    x              = fill_state_reg;
+    x              = x ^ (x << 13);
+    x              = x ^ (x >> 17);
+    x              = x ^ (x << 5);
+    fill_state_new = x + fill_acc_reg;
+  end
+
+
   //----------------------------------------------------------------
   // mem_mux
   //
-  // Select which of the data read from the banks should be
-  // returned during a read access.
+  // Select the access to perform on the banks, and which of the
+  // data read from the banks should be returned during a read
+  // access. While filling, a fill word is written to the next
+  // physical address in every cycle without an access. The read
+  // data is selected by the address of the access, so a fill
+  // write in the cycle after a read doesn't affect it.
   //----------------------------------------------------------------
   always @* begin : mem_mux
-    cs0 = ~scrambled_ram_addr[14] & cs;
-    cs1 = scrambled_ram_addr[14] & cs;
+    cs0              = ~scrambled_ram_addr[14] & cs;
+    cs1              = scrambled_ram_addr[14] & cs;
+    spram_we         = we;
+    spram_addr       = scrambled_ram_addr[13 : 0];
+    spram_write_data = scrambled_write_data;
+    fill_next        = 1'h0;
+
+    if (fill_busy_reg && !cs) begin
+      cs0              = ~fill_addr_reg[14];
+      cs1              = fill_addr_reg[14];
+      spram_we         = 4'hf;
+      spram_addr       = fill_addr_reg[13 : 0];
+      spram_write_data = fill_state_new;
+      fill_next        = 1'h1;
+    end
 
     if (scrambled_ram_addr[14]) begin
       muxed_read_data = read_data1;
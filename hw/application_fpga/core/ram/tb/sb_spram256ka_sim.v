@@ -0,0 +1,67 @@
+//======================================================================
+//
+// sb_spram256ka_sim.v
+// -------------------
+// Simulation model of the SB_SPRAM256KA hard macro in Lattice iCE40
+// UP devices. This is just to be able to build the testbench. Only
+// the read and masked write functionality is modelled, the power
+// saving modes are not.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module SB_SPRAM256KA (
+    input wire [13 : 0] ADDRESS,
+    input wire [15 : 0] DATAIN,
+    input wire [ 3 : 0] MASKWREN,
+    input wire          WREN,
+    input wire          CHIPSELECT,
+    input wire          CLOCK,
+
+    /* verilator lint_off UNUSEDSIGNAL */
+    input wire STANDBY,
+    input wire SLEEP,
+    input wire POWEROFF,
+    /* verilator lint_on UNUSEDSIGNAL */
+
+    output reg [15 : 0] DATAOUT
+);
+
+  reg [15 : 0] mem[0 : 16383];
+
+
+  always @(posedge CLOCK) begin : mem_update
+    if (CHIPSELECT) begin
+      if (WREN) begin
+        if (MASKWREN[0]) begin
+          mem[ADDRESS][3 : 0] <= DATAIN[3 : 0];
+        end
+
+        if (MASKWREN[1]) begin
+          mem[ADDRESS][7 : 4] <= DATAIN[7 : 4];
+        end
+
+        if (MASKWREN[2]) begin
+          mem[ADDRESS][11 : 8] <= DATAIN[11 : 8];
+        end
+
+        if (MASKWREN[3]) begin
+          mem[ADDRESS][15 : 12] <= DATAIN[15 : 12];
+        end
+      end
+      else begin
+        DATAOUT <= mem[ADDRESS];
+      end
+    end
+  end  // mem_update
+
+endmodule  // SB_SPRAM256KA
+
+//======================================================================
+// EOF sb_spram256ka_sim.v
+//======================================================================
@@ -0,0 +1,580 @@
+//======================================================================
+//
+// tb_ram.v
+// --------
+// Testbench for the ram core. Checks the address and data
+// scrambling, and the fill engine.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module tb_ram ();
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  parameter DEBUG = 0;
+
+  parameter CLK_HALF_PERIOD = 1;
+  parameter CLK_PERIOD = 2 * CLK_HALF_PERIOD;
+
+  localparam RAM_WORDS = 32768;
+
+
+  //----------------------------------------------------------------
+  // Register and Wire declarations.
+  //----------------------------------------------------------------
+  reg  [31 : 0] cycle_ctr;
+  reg  [31 : 0] error_ctr;
+  reg  [31 : 0] tc_ctr;
+  reg           tb_monitor;
+
+  reg           tb_clk;
+  reg           tb_reset_n;
+
+  reg  [14 : 0] tb_ram_addr_rand;
+  reg  [31 : 0] tb_ram_data_rand;
+
+  reg  [31 : 0] tb_fill_data;
+  reg           tb_fill_state_we;
+  reg           tb_fill_acc_we;
+  reg           tb_fill_start;
+  wire          tb_fill_busy;
+
+  reg           tb_cs;
+  reg  [ 3 : 0] tb_we;
+  reg  [15 : 0] tb_address;
+  reg  [31 : 0] tb_write_data;
+  wire [31 : 0] tb_read_data;
+  wire          tb_ready;
+
+  reg  [31 : 0] read_data;
+  reg  [31 : 0] fill_cycles;
+  time          fill_start_time;
+  reg           touched     [0 : (RAM_WORDS - 1)];
+
+
+  //----------------------------------------------------------------
+  // Device Under Test.
+  //----------------------------------------------------------------
+  ram dut (
+      .clk(tb_clk),
+      .reset_n(tb_reset_n),
+
+      .ram_addr_rand(tb_ram_addr_rand),
+      .ram_data_rand(tb_ram_data_rand),
+
+      .fill_data(tb_fill_data),
+      .fill_state_we(tb_fill_state_we),
+      .fill_acc_we(tb_fill_acc_we),
+      .fill_start(tb_fill_start),
+      .fill_busy(tb_fill_busy),
+
+      .cs(tb_cs),
+      .we(tb_we),
+      .address(tb_address),
+      .write_data(tb_write_data),
+      .read_data(tb_read_data),
+      .ready(tb_ready)
+  );
+
+
+  //----------------------------------------------------------------
+  // clk_gen
+  //
+  // Always running clock generator process.
+  //----------------------------------------------------------------
+  always begin : clk_gen
+    #CLK_HALF_PERIOD;
+    tb_clk = !tb_clk;
+  end  // clk_gen
+
+
+  //----------------------------------------------------------------
+  // sys_monitor()
+  //
+  // An always running process that creates a cycle counter and
+  // conditionally displays information about the DUT.
+  //----------------------------------------------------------------
+  always begin : sys_monitor
+    cycle_ctr = cycle_ctr + 1;
+    #(CLK_PERIOD);
+    if (tb_monitor) begin
+      dump_dut_state();
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // dump_dut_state()
+  //
+  // Dump the state of the dump when needed.
+  //----------------------------------------------------------------
+  task dump_dut_state;
+    begin
+      $display("State of DUT");
+      $display("------------");
+      $display("Cycle: %08d", cycle_ctr);
+      $display("");
+      $display("Inputs and outputs:");
+      $display(
+          "cs: 0x%1x, we: 0x%1x, address: 0x%04x, write_data: 0x%08x, read_data: 0x%08x, ready: 0x%1x",
+          tb_cs, tb_we, tb_address, tb_write_data, tb_read_data, tb_ready);
+      $display("fill_busy: 0x%1x", tb_fill_busy);
+      $display("");
+      $display("Internal state:");
+      $display("fill_state: 0x%08x, fill_acc: 0x%08x, fill_addr: 0x%04x", dut.fill_state_reg,
+               dut.fill_acc_reg, dut.fill_addr_reg);
+      $display("cs0: 0x%1x, cs1: 0x%1x, spram_we: 0x%1x, spram_addr: 0x%04x", dut.cs0, dut.cs1,
+               dut.spram_we, dut.spram_addr);
+      $display("");
+      $display("");
+    end
+  endtask  // dump_dut_state
+
+
+  //----------------------------------------------------------------
+  // reset_dut()
+  //
+  // Toggle reset to put the DUT into a well known state.
+  //----------------------------------------------------------------
+  task reset_dut;
+    begin
+      $display("--- Toggle reset.");
+      tb_reset_n = 0;
+      #(2 * CLK_PERIOD);
+      tb_reset_n = 1;
+    end
+  endtask  // reset_dut
+
+
+  //----------------------------------------------------------------
+  // display_test_result()
+  //
+  // Display the accumulated test results.
+  //----------------------------------------------------------------
+  task display_test_result;
+    begin
+      if (error_ctr == 0) begin
+        $display("--- All %02d test cases completed successfully", tc_ctr);
+      end
+      else begin
+        $display("--- %02d tests completed - %02d test cases did not complete successfully.",
+                 tc_ctr, error_ctr);
+      end
+    end
+  endtask  // display_test_result
+
+
+  //----------------------------------------------------------------
+  // init_sim()
+  //
+  // Initialize all counters and testbed functionality as well
+  // as setting the DUT inputs to defined values.
+  //----------------------------------------------------------------
+  task init_sim;
+    begin
+      cycle_ctr        = 0;
+      error_ctr        = 0;
+      tc_ctr           = 0;
+      tb_monitor       = 0;
+
+      tb_clk           = 1'h0;
+      tb_reset_n       = 1'h1;
+
+      tb_ram_addr_rand = 15'h0;
+      tb_ram_data_rand = 32'h0;
+
+      tb_fill_data     = 32'h0;
+      tb_fill_state_we = 1'h0;
+      tb_fill_acc_we   = 1'h0;
+      tb_fill_start    = 1'h0;
+
+      tb_cs            = 1'h0;
+      tb_we            = 4'h0;
+      tb_address       = 16'h0;
+      tb_write_data    = 32'h0;
+    end
+  endtask  // init_sim
+
+
+  //----------------------------------------------------------------
+  // write_word()
+  //
+  // Write the given word to the DUT at the given word address.
+  //----------------------------------------------------------------
+  task write_word(input [15 : 0] address, input [31 : 0] word);
+    begin
+      if (DEBUG) begin
+        $display("--- Writing 0x%08x to 0x%04x.", word, address);
+        $display("");
+      end
+
+      tb_address    = address;
+      tb_write_data = word;
+      tb_cs         = 1'h1;
+      tb_we         = 4'hf;
+      #(CLK_PERIOD);
+      tb_cs = 1'h0;
+      tb_we = 4'h0;
+    end
+  endtask  // write_word
+
+
+  //----------------------------------------------------------------
+  // read_word()
+  //
+  // Read a data word from the given word address in the DUT. The
+  // address is held in the cycle after the access, when the data
+  // is ready, but cs isn't. The word read will be available in
+  // the global variable read_data.
+  //----------------------------------------------------------------
+  task read_word(input [15 : 0] address);
+    begin
+      tb_address = address;
+      tb_cs      = 1'h1;
+      tb_we      = 4'h0;
+      #(CLK_PERIOD);
+      tb_cs = 1'h0;
+      #(CLK_PERIOD);
+      read_data = tb_read_data;
+
+      if (DEBUG) begin
+        $display("--- Reading 0x%08x from 0x%04x.", read_data, address);
+        $display("");
+      end
+    end
+  endtask  // read_word
+
+
+  //----------------------------------------------------------------
+  // check_word()
+  //
+  // Read a word and compare it to the expected value.
+  //----------------------------------------------------------------
+  task check_word(input [15 : 0] address, input [31 : 0] expected);
+    begin
+      read_word(address);
+      if (read_data != expected) begin
+        $display("--- Error: Got 0x%08x from 0x%04x, expected 0x%08x.", read_data, address,
+                 expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_word
+
+
+  //----------------------------------------------------------------
+  // start_fill()
+  //
+  // Seed the fill engine and start it.
+  //----------------------------------------------------------------
+  task start_fill(input [31 : 0] state, input [31 : 0] acc);
+    begin
+      tb_fill_data     = state;
+      tb_fill_state_we = 1'h1;
+      #(CLK_PERIOD);
+      tb_fill_state_we = 1'h0;
+
+      tb_fill_data     = acc;
+      tb_fill_acc_we   = 1'h1;
+      #(CLK_PERIOD);
+      tb_fill_acc_we = 1'h0;
+
+      tb_fill_start  = 1'h1;
+      #(CLK_PERIOD);
+      tb_fill_start   = 1'h0;
+      fill_start_time = $time;
+    end
+  endtask  // start_fill
+
+
+  //----------------------------------------------------------------
+  // wait_fill()
+  //
+  // Wait for the fill to complete and count the cycles since it
+  // was started.
+  //----------------------------------------------------------------
+  task wait_fill;
+    begin
+      while (tb_fill_busy) begin
+        #(CLK_PERIOD);
+      end
+      fill_cycles = ($time - fill_start_time) / CLK_PERIOD;
+    end
+  endtask  // wait_fill
+
+
+  //----------------------------------------------------------------
+  // check_fill()
+  //
+  // Check the physical memory contents against the xorwow
+  // sequence from the given seeds, skipping words marked as
+  // touched by other writes.
+  //----------------------------------------------------------------
+  task check_fill(input [31 : 0] state, input [31 : 0] acc);
+    begin : check_fill
+      integer i;
+      integer errors;
+      reg [31 : 0] x;
+      reg [31 : 0] mem_word;
+
+      errors = 0;
+      x = state;
+      for (i = 0; i < RAM_WORDS; i = i + 1) begin
+        x = x ^ (x << 13);
+        x = x ^ (x >> 17);
+        x = x ^ (x << 5);
+        x = x + acc;
+
+        if (i < RAM_WORDS / 2) begin
+          mem_word = {dut.spram1.mem[i], dut.spram0.mem[i]};
+        end
+        else begin
+          mem_word = {dut.spram3.mem[i-RAM_WORDS/2], dut.spram2.mem[i-RAM_WORDS/2]};
+        end
+
+        if (!touched[i] && (mem_word != x)) begin
+          if (errors < 8) begin
+            $display("--- Error: Got 0x%08x at physical word 0x%04x, expected 0x%08x.",
+                     mem_word, i, x);
+          end
+          errors = errors + 1;
+        end
+      end
+
+      if (errors > 0) begin
+        $display("--- Error: %0d words not filled as expected.", errors);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_fill
+
+
+  //----------------------------------------------------------------
+  // clear_touched()
+  //----------------------------------------------------------------
+  task clear_touched;
+    begin : clear_touched
+      integer i;
+
+      for (i = 0; i < RAM_WORDS; i = i + 1) begin
+        touched[i] = 1'h0;
+      end
+    end
+  endtask  // clear_touched
+
+
+  //----------------------------------------------------------------
+  // test1()
+  // Write and read back words in both banks with and without
+  // scrambling.
+  //----------------------------------------------------------------
+  task test1;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test1: Write and read started.");
+
+      write_word(16'h0000, 32'h01234567);
+      write_word(16'h4000, 32'h89abcdef);
+      write_word(16'h7fff, 32'hdeadbeef);
+      check_word(16'h0000, 32'h01234567);
+      check_word(16'h4000, 32'h89abcdef);
+      check_word(16'h7fff, 32'hdeadbeef);
+
+      tb_ram_addr_rand = 15'h5a5a;
+      tb_ram_data_rand = 32'hf00ff00f;
+      write_word(16'h0001, 32'h13371337);
+      write_word(16'h4001, 32'h47114711);
+      check_word(16'h0001, 32'h13371337);
+      check_word(16'h4001, 32'h47114711);
+      tb_ram_addr_rand = 15'h0;
+      tb_ram_data_rand = 32'h0;
+
+      $display("--- test1: completed.");
+      $display("");
+    end
+  endtask  // test1
+
+
+  //----------------------------------------------------------------
+  // test2()
+  // Fill the RAM without any other accesses. The fill should
+  // write one word per cycle.
+  //----------------------------------------------------------------
+  task test2;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test2: Fill without accesses started.");
+
+      clear_touched();
+      start_fill(32'h13371337, 32'h47114711);
+      wait_fill();
+      $display("--- test2: Fill took %0d cycles.", fill_cycles);
+
+      if (fill_cycles != RAM_WORDS) begin
+        $display("--- Error: Fill took %0d cycles, expected %0d.", fill_cycles, RAM_WORDS);
+        error_ctr = error_ctr + 1;
+      end
+
+      check_fill(32'h13371337, 32'h47114711);
+
+      $display("--- test2: completed.");
+      $display("");
+    end
+  endtask  // test2
+
+
+  //----------------------------------------------------------------
+  // test3()
+  // Fill the RAM while writing and reading scrambled words. The
+  // accesses take priority over the fill and must not be
+  // disturbed by it. The fill is delayed by the accesses.
+  //----------------------------------------------------------------
+  task test3;
+    begin : test3
+      integer i;
+      reg [15 : 0] address;
+
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test3: Fill with accesses started.");
+
+      tb_ram_addr_rand = 15'h2bad;
+      tb_ram_data_rand = 32'hcafebabe;
+
+      clear_touched();
+      start_fill(32'hdeadbeef, 32'hf00ff00f);
+
+      for (i = 0; i < 256; i = i + 1) begin
+        address = i * 16'h0083;
+        touched[address[14 : 0]^tb_ram_addr_rand] = 1'h1;
+        write_word(address, i * 32'h9e3779b9);
+        check_word(address, i * 32'h9e3779b9);
+      end
+
+      wait_fill();
+      $display("--- test3: Fill took %0d cycles.", fill_cycles);
+
+      if (fill_cycles != RAM_WORDS + 256 * 2) begin
+        $display("--- Error: Fill took %0d cycles, expected %0d.", fill_cycles,
+                 RAM_WORDS + 256 * 2);
+        error_ctr = error_ctr + 1;
+      end
+
+      check_fill(32'hdeadbeef, 32'hf00ff00f);
+
+      tb_ram_addr_rand = 15'h0;
+      tb_ram_data_rand = 32'h0;
+
+      $display("--- test3: completed.");
+      $display("");
+    end
+  endtask  // test3
+
+
+  //----------------------------------------------------------------
+  // test4()
+  // Reset the core in the middle of a fill. The fill must stop and
+  // leave the rest of the memory alone. A new fill must then start
+  // over from the first word and fill all of the memory.
+  //----------------------------------------------------------------
+  task test4;
+    begin : test4
+      reg [31 : 0] last_word;
+
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test4: Reset during fill started.");
+
+      last_word = {dut.spram3.mem[RAM_WORDS/2-1], dut.spram2.mem[RAM_WORDS/2-1]};
+
+      clear_touched();
+      start_fill(32'h0badf00d, 32'h600dcafe);
+      #(1000 * CLK_PERIOD);
+      reset_dut();
+
+      if (tb_fill_busy) begin
+        $display("--- Error: Fill still busy after reset.");
+        error_ctr = error_ctr + 1;
+      end
+
+      #(100 * CLK_PERIOD);
+      if ({dut.spram3.mem[RAM_WORDS/2-1], dut.spram2.mem[RAM_WORDS/2-1]} != last_word) begin
+        $display("--- Error: Last word written after reset.");
+        error_ctr = error_ctr + 1;
+      end
+
+      start_fill(32'h31415926, 32'h27182818);
+      wait_fill();
+      $display("--- test4: Fill after reset took %0d cycles.", fill_cycles);
+
+      if (fill_cycles != RAM_WORDS) begin
+        $display("--- Error: Fill took %0d cycles, expected %0d.", fill_cycles, RAM_WORDS);
+        error_ctr = error_ctr + 1;
+      end
+
+      check_fill(32'h31415926, 32'h27182818);
+
+      $display("--- test4: completed.");
+      $display("");
+    end
+  endtask  // test4
+
+
+  //----------------------------------------------------------------
+  // exit_with_error_code()
+  //
+  // Exit with the right error code
+  //----------------------------------------------------------------
+  task exit_with_error_code;
+    begin
+      if (error_ctr == 0) begin
+        $finish(0);
+      end
+      else begin
+        $fatal(1);
+      end
+    end
+  endtask  // exit_with_error_code
+
+
+  //----------------------------------------------------------------
+  // ram_test
+  //----------------------------------------------------------------
+  initial begin : ram_test
+    $display("");
+    $display("   -= Testbench for ram started =-");
+    $display("     ===========================");
+    $display("");
+
+    init_sim();
+    reset_dut();
+    test1();
+    test2();
+    test3();
+    test4();
+
+    display_test_result();
+    $display("");
+    $display("   -= Testbench for ram completed =-");
+    $display("     =============================");
+    $display("");
+    exit_with_error_code();
+  end  // ram_test
+endmodule  // tb_ram
+
+//======================================================================
+// EOF tb_ram.v
+//======================================================================
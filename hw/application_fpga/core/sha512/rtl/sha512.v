@@ -0,0 +1,152 @@
+//======================================================================
+//
+// sha512.v
+// --------
+// Top level wrapper for the SHA-512 core.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module sha512 (
+    input wire clk,
+    input wire reset_n,
+
+    input  wire          cs,
+    input  wire          we,
+    input  wire [ 7 : 0] address,
+    input  wire [31 : 0] write_data,
+    output wire [31 : 0] read_data,
+    output wire          ready
+);
+
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  localparam ADDR_NAME0 = 8'h00;
+  localparam ADDR_NAME1 = 8'h01;
+  localparam ADDR_VERSION = 8'h02;
+
+  localparam ADDR_CTRL = 8'h08;
+  localparam CTRL_NEXT_BIT = 0;
+
+  localparam ADDR_STATUS = 8'h09;
+  localparam STATUS_READY_BIT = 0;
+
+  localparam ADDR_BLOCK0 = 8'h20;
+  localparam ADDR_BLOCK31 = 8'h3f;
+
+  localparam ADDR_H0 = 8'h40;
+  localparam ADDR_H15 = 8'h4f;
+
+  localparam CORE_NAME0 = 32'h73686135;  // "sha5"
+  localparam CORE_NAME1 = 32'h31322020;  // "12  "
+  localparam CORE_VERSION = 32'h00000001;
+
+
+  //----------------------------------------------------------------
+  // Wires.
+  //----------------------------------------------------------------
+  reg  [31 : 0] tmp_read_data;
+  reg           tmp_ready;
+
+  reg           core_next;
+  reg           h_we;
+  reg           block_we;
+
+  wire [31 : 0] core_h_word;
+  wire          core_ready;
+
+
+  //----------------------------------------------------------------
+  // Concurrent connectivity for ports etc.
+  //----------------------------------------------------------------
+  assign read_data = tmp_read_data;
+  assign ready     = tmp_ready;
+
+
+  //----------------------------------------------------------------
+  // core instantiation.
+  //----------------------------------------------------------------
+  sha512_core core (
+      .clk(clk),
+      .reset_n(reset_n),
+
+      .next(core_next),
+
+      .h_we(h_we),
+      .block_we(block_we),
+      .word_addr(address[4 : 0]),
+      .write_data(write_data),
+      .h_word(core_h_word),
+
+      .ready(core_ready)
+  );
+
+
+  //----------------------------------------------------------------
+  // api
+  //
+  // The interface command decoding logic. The block and chaining
+  // value can only be written while the core is ready. The block
+  // is write only.
+  //----------------------------------------------------------------
+  always @* begin : api
+    core_next     = 1'h0;
+    h_we          = 1'h0;
+    block_we      = 1'h0;
+    tmp_read_data = 32'h0;
+    tmp_ready     = 1'h0;
+
+    if (cs) begin
+      tmp_ready = 1'h1;
+
+      if (we) begin
+        if (core_ready) begin
+          if (address == ADDR_CTRL) begin
+            core_next = write_data[CTRL_NEXT_BIT];
+          end
+
+          if ((address >= ADDR_BLOCK0) && (address <= ADDR_BLOCK31)) begin
+            block_we = 1'h1;
+          end
+
+          if ((address >= ADDR_H0) && (address <= ADDR_H15)) begin
+            h_we = 1'h1;
+          end
+        end
+      end
+
+      else begin
+        if (address == ADDR_NAME0) begin
+          tmp_read_data = CORE_NAME0;
+        end
+
+        if (address == ADDR_NAME1) begin
+          tmp_read_data = CORE_NAME1;
+        end
+
+        if (address == ADDR_VERSION) begin
+          tmp_read_data = CORE_VERSION;
+        end
+
+        if (address == ADDR_STATUS) begin
+          tmp_read_data[STATUS_READY_BIT] = core_ready;
+        end
+
+        if ((address >= ADDR_H0) && (address <= ADDR_H15)) begin
+          tmp_read_data = core_h_word;
+        end
+      end
+    end
+  end  // api
+endmodule  // sha512
+
+//======================================================================
+// EOF sha512.v
+//======================================================================
@@ -0,0 +1,407 @@
+//======================================================================
+//
+// sha512_core.v
+// -------------
+// SHA-512 compression engine. Compresses one 128 byte message block
+// into the chaining value h. Padding and the length is left to SW.
+//
+// One round is performed every cycle. The message schedule is kept
+// as a window of the 16 latest words, and the next word is computed
+// in parallel with the round. The sum of h, the round constant and
+// the message word is computed in the round before, to shorten the
+// adder chain in the round. A block takes 82 cycles to compress.
+//
+// The block is written into the message schedule window, which is
+// overwritten while compressing. A new block must be written for
+// every compression.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module sha512_core (
+    input wire clk,
+    input wire reset_n,
+
+    input wire next,
+
+    input  wire          h_we,
+    input  wire          block_we,
+    input  wire [ 4 : 0] word_addr,
+    input  wire [31 : 0] write_data,
+    output wire [31 : 0] h_word,
+
+    output wire          ready
+);
+
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  localparam CTRL_IDLE = 2'h0;
+  localparam CTRL_INIT = 2'h1;
+  localparam CTRL_ROUNDS = 2'h2;
+  localparam CTRL_FINAL = 2'h3;
+
+
+  //----------------------------------------------------------------
+  // Functions.
+  //----------------------------------------------------------------
+  // The round constants.
+  function [63 : 0] k(input [6 : 0] round);
+    begin
+      case (round)
+        7'd0: k = 64'h428a2f98d728ae22;
+        7'd1: k = 64'h7137449123ef65cd;
+        7'd2: k = 64'hb5c0fbcfec4d3b2f;
+        7'd3: k = 64'he9b5dba58189dbbc;
+        7'd4: k = 64'h3956c25bf348b538;
+        7'd5: k = 64'h59f111f1b605d019;
+        7'd6: k = 64'h923f82a4af194f9b;
+        7'd7: k = 64'hab1c5ed5da6d8118;
+        7'd8: k = 64'hd807aa98a3030242;
+        7'd9: k = 64'h12835b0145706fbe;
+        7'd10: k = 64'h243185be4ee4b28c;
+        7'd11: k = 64'h550c7dc3d5ffb4e2;
+        7'd12: k = 64'h72be5d74f27b896f;
+        7'd13: k = 64'h80deb1fe3b1696b1;
+        7'd14: k = 64'h9bdc06a725c71235;
+        7'd15: k = 64'hc19bf174cf692694;
+        7'd16: k = 64'he49b69c19ef14ad2;
+        7'd17: k = 64'hefbe4786384f25e3;
+        7'd18: k = 64'h0fc19dc68b8cd5b5;
+        7'd19: k = 64'h240ca1cc77ac9c65;
+        7'd20: k = 64'h2de92c6f592b0275;
+        7'd21: k = 64'h4a7484aa6ea6e483;
+        7'd22: k = 64'h5cb0a9dcbd41fbd4;
+        7'd23: k = 64'h76f988da831153b5;
+        7'd24: k = 64'h983e5152ee66dfab;
+        7'd25: k = 64'ha831c66d2db43210;
+        7'd26: k = 64'hb00327c898fb213f;
+        7'd27: k = 64'hbf597fc7beef0ee4;
+        7'd28: k = 64'hc6e00bf33da88fc2;
+        7'd29: k = 64'hd5a79147930aa725;
+        7'd30: k = 64'h06ca6351e003826f;
+        7'd31: k = 64'h142929670a0e6e70;
+        7'd32: k = 64'h27b70a8546d22ffc;
+        7'd33: k = 64'h2e1b21385c26c926;
+        7'd34: k = 64'h4d2c6dfc5ac42aed;
+        7'd35: k = 64'h53380d139d95b3df;
+        7'd36: k = 64'h650a73548baf63de;
+        7'd37: k = 64'h766a0abb3c77b2a8;
+        7'd38: k = 64'h81c2c92e47edaee6;
+        7'd39: k = 64'h92722c851482353b;
+        7'd40: k = 64'ha2bfe8a14cf10364;
+        7'd41: k = 64'ha81a664bbc423001;
+        7'd42: k = 64'hc24b8b70d0f89791;
+        7'd43: k = 64'hc76c51a30654be30;
+        7'd44: k = 64'hd192e819d6ef5218;
+        7'd45: k = 64'hd69906245565a910;
+        7'd46: k = 64'hf40e35855771202a;
+        7'd47: k = 64'h106aa07032bbd1b8;
+        7'd48: k = 64'h19a4c116b8d2d0c8;
+        7'd49: k = 64'h1e376c085141ab53;
+        7'd50: k = 64'h2748774cdf8eeb99;
+        7'd51: k = 64'h34b0bcb5e19b48a8;
+        7'd52: k = 64'h391c0cb3c5c95a63;
+        7'd53: k = 64'h4ed8aa4ae3418acb;
+        7'd54: k = 64'h5b9cca4f7763e373;
+        7'd55: k = 64'h682e6ff3d6b2b8a3;
+        7'd56: k = 64'h748f82ee5defb2fc;
+        7'd57: k = 64'h78a5636f43172f60;
+        7'd58: k = 64'h84c87814a1f0ab72;
+        7'd59: k = 64'h8cc702081a6439ec;
+        7'd60: k = 64'h90befffa23631e28;
+        7'd61: k = 64'ha4506cebde82bde9;
+        7'd62: k = 64'hbef9a3f7b2c67915;
+        7'd63: k = 64'hc67178f2e372532b;
+        7'd64: k = 64'hca273eceea26619c;
+        7'd65: k = 64'hd186b8c721c0c207;
+        7'd66: k = 64'heada7dd6cde0eb1e;
+        7'd67: k = 64'hf57d4f7fee6ed178;
+        7'd68: k = 64'h06f067aa72176fba;
+        7'd69: k = 64'h0a637dc5a2c898a6;
+        7'd70: k = 64'h113f9804bef90dae;
+        7'd71: k = 64'h1b710b35131c471b;
+        7'd72: k = 64'h28db77f523047d84;
+        7'd73: k = 64'h32caab7b40c72493;
+        7'd74: k = 64'h3c9ebe0a15c9bebc;
+        7'd75: k = 64'h431d67c49c100d4c;
+        7'd76: k = 64'h4cc5d4becb3e42b6;
+        7'd77: k = 64'h597f299cfc657e2a;
+        7'd78: k = 64'h5fcb6fab3ad6faec;
+        7'd79: k = 64'h6c44198c4a475817;
+        default: k = 64'h0;
+      endcase
+    end
+  endfunction
+
+  function [63 : 0] rotr(input [63 : 0] x, input integer c);
+    begin
+      rotr = (x >> c) | (x << (64 - c));
+    end
+  endfunction
+
+
+  //----------------------------------------------------------------
+  // Registers including update variables and write enable.
+  //----------------------------------------------------------------
+  reg [63 : 0] h_reg         [0 : 7];
+  reg          h_update;
+
+  reg [63 : 0] w_reg         [0 : 15];
+  reg [63 : 0] w_new;
+  reg          w_shift;
+
+  reg [63 : 0] a_reg;
+  reg [63 : 0] b_reg;
+  reg [63 : 0] c_reg;
+  reg [63 : 0] d_reg;
+  reg [63 : 0] e_reg;
+  reg [63 : 0] f_reg;
+  reg [63 : 0] g_reg;
+  reg [63 : 0] h_work_reg;
+  reg [63 : 0] a_new;
+  reg [63 : 0] e_new;
+  reg          work_init;
+  reg          work_update;
+
+  reg [63 : 0] hkw_reg;
+  reg [63 : 0] hkw_new;
+
+  reg [ 6 : 0] round_ctr_reg;
+  reg [ 6 : 0] round_ctr_new;
+  reg          round_ctr_we;
+
+  reg          ready_reg;
+  reg          ready_new;
+  reg          ready_we;
+
+  reg [ 1 : 0] sha512_ctrl_reg;
+  reg [ 1 : 0] sha512_ctrl_new;
+  reg          sha512_ctrl_we;
+
+
+  //----------------------------------------------------------------
+  // Concurrent connectivity for ports etc.
+  //----------------------------------------------------------------
+  assign h_word = word_addr[0] ? h_reg[word_addr[3 : 1]][31 : 0] :
+                                 h_reg[word_addr[3 : 1]][63 : 32];
+
+  assign ready  = ready_reg;
+
+
+  //----------------------------------------------------------------
+  // reg_update
+  //----------------------------------------------------------------
+  always @(posedge clk) begin : reg_update
+    integer i;
+
+    if (!reset_n) begin
+      for (i = 0; i < 8; i = i + 1) begin
+        h_reg[i] <= 64'h0;
+      end
+
+      for (i = 0; i < 16; i = i + 1) begin
+        w_reg[i] <= 64'h0;
+      end
+
+      a_reg           <= 64'h0;
+      b_reg           <= 64'h0;
+      c_reg           <= 64'h0;
+      d_reg           <= 64'h0;
+      e_reg           <= 64'h0;
+      f_reg           <= 64'h0;
+      g_reg           <= 64'h0;
+      h_work_reg      <= 64'h0;
+      hkw_reg         <= 64'h0;
+      round_ctr_reg   <= 7'h0;
+      ready_reg       <= 1'h1;
+      sha512_ctrl_reg <= CTRL_IDLE;
+    end
+
+    else begin
+      if (h_update) begin
+        h_reg[0] <= h_reg[0] + a_reg;
+        h_reg[1] <= h_reg[1] + b_reg;
+        h_reg[2] <= h_reg[2] + c_reg;
+        h_reg[3] <= h_reg[3] + d_reg;
+        h_reg[4] <= h_reg[4] + e_reg;
+        h_reg[5] <= h_reg[5] + f_reg;
+        h_reg[6] <= h_reg[6] + g_reg;
+        h_reg[7] <= h_reg[7] + h_work_reg;
+      end
+
+      if (h_we) begin
+        if (word_addr[0]) begin
+          h_reg[word_addr[3 : 1]][31 : 0] <= write_data;
+        end
+        else begin
+          h_reg[word_addr[3 : 1]][63 : 32] <= write_data;
+        end
+      end
+
+      if (block_we) begin
+        if (word_addr[0]) begin
+          w_reg[word_addr[4 : 1]][31 : 0] <= write_data;
+        end
+        else begin
+          w_reg[word_addr[4 : 1]][63 : 32] <= write_data;
+        end
+      end
+
+      if (w_shift) begin
+        for (i = 0; i < 15; i = i + 1) begin
+          w_reg[i] <= w_reg[i + 1];
+        end
+        w_reg[15] <= w_new;
+      end
+
+      if (work_init) begin
+        a_reg      <= h_reg[0];
+        b_reg      <= h_reg[1];
+        c_reg      <= h_reg[2];
+        d_reg      <= h_reg[3];
+        e_reg      <= h_reg[4];
+        f_reg      <= h_reg[5];
+        g_reg      <= h_reg[6];
+        h_work_reg <= h_reg[7];
+      end
+
+      if (work_update) begin
+        a_reg      <= a_new;
+        b_reg      <= a_reg;
+        c_reg      <= b_reg;
+        d_reg      <= c_reg;
+        e_reg      <= e_new;
+        f_reg      <= e_reg;
+        g_reg      <= f_reg;
+        h_work_reg <= g_reg;
+      end
+
+      if (work_init || work_update) begin
+        hkw_reg <= hkw_new;
+      end
+
+      if (round_ctr_we) begin
+        round_ctr_reg <= round_ctr_new;
+      end
+
+      if (ready_we) begin
+        ready_reg <= ready_new;
+      end
+
+      if (sha512_ctrl_we) begin
+        sha512_ctrl_reg <= sha512_ctrl_new;
+      end
+    end
+  end  // reg_update
+
+
+  //----------------------------------------------------------------
+  // round_logic
+  //
+  // The round function and the next word of the message schedule.
+  // hkw_reg holds h + k + w for the current round. While the
+  // working variables are initialized it is computed for round
+  // zero, and during a round for the round after, where g becomes
+  // h and the second word of the window becomes the first.
+  //----------------------------------------------------------------
+  always @* begin : round_logic
+    reg [63 : 0] sum1;
+    reg [63 : 0] ch;
+    reg [63 : 0] sum0;
+    reg [63 : 0] maj;
+    reg [63 : 0] t1;
+    reg [63 : 0] t2;
+    reg [63 : 0] s0;
+    reg [63 : 0] s1;
+
+    sum1  = rotr(e_reg, 14) ^ rotr(e_reg, 18) ^ rotr(e_reg, 41);
+    ch    = (e_reg & f_reg) ^ (~e_reg & g_reg);
+    sum0  = rotr(a_reg, 28) ^ rotr(a_reg, 34) ^ rotr(a_reg, 39);
+    maj   = (a_reg & b_reg) ^ (a_reg & c_reg) ^ (b_reg & c_reg);
+    t1    = hkw_reg + sum1 + ch;
+    t2    = sum0 + maj;
+    a_new = t1 + t2;
+    e_new = d_reg + t1;
+
+    s0    = rotr(w_reg[1], 1) ^ rotr(w_reg[1], 8) ^ (w_reg[1] >> 7);
+    s1    = rotr(w_reg[14], 19) ^ rotr(w_reg[14], 61) ^ (w_reg[14] >> 6);
+    w_new = s1 + w_reg[9] + s0 + w_reg[0];
+
+    if (work_init) begin
+      hkw_new = h_reg[7] + k(7'h0) + w_reg[0];
+    end
+    else begin
+      hkw_new = g_reg + k(round_ctr_reg + 1'h1) + w_reg[1];
+    end
+  end  // round_logic
+
+
+  //----------------------------------------------------------------
+  // sha512_ctrl
+  //----------------------------------------------------------------
+  always @* begin : sha512_ctrl
+    work_init       = 1'h0;
+    work_update     = 1'h0;
+    w_shift         = 1'h0;
+    h_update        = 1'h0;
+    round_ctr_new   = 7'h0;
+    round_ctr_we    = 1'h0;
+    ready_new       = 1'h0;
+    ready_we        = 1'h0;
+    sha512_ctrl_new = CTRL_IDLE;
+    sha512_ctrl_we  = 1'h0;
+
+    case (sha512_ctrl_reg)
+      CTRL_IDLE: begin
+        if (next) begin
+          ready_new       = 1'h0;
+          ready_we        = 1'h1;
+          sha512_ctrl_new = CTRL_INIT;
+          sha512_ctrl_we  = 1'h1;
+        end
+      end
+
+      CTRL_INIT: begin
+        work_init       = 1'h1;
+        round_ctr_new   = 7'h0;
+        round_ctr_we    = 1'h1;
+        sha512_ctrl_new = CTRL_ROUNDS;
+        sha512_ctrl_we  = 1'h1;
+      end
+
+      CTRL_ROUNDS: begin
+        work_update   = 1'h1;
+        w_shift       = 1'h1;
+        round_ctr_new = round_ctr_reg + 1'h1;
+        round_ctr_we  = 1'h1;
+
+        if (round_ctr_reg == 7'd79) begin
+          sha512_ctrl_new = CTRL_FINAL;
+          sha512_ctrl_we  = 1'h1;
+        end
+      end
+
+      CTRL_FINAL: begin
+        h_update        = 1'h1;
+        ready_new       = 1'h1;
+        ready_we        = 1'h1;
+        sha512_ctrl_new = CTRL_IDLE;
+        sha512_ctrl_we  = 1'h1;
+      end
+
+      default: begin
+      end
+    endcase
+  end  // sha512_ctrl
+endmodule  // sha512_core
+
+//======================================================================
+// EOF sha512_core.v
+//======================================================================
@@ -0,0 +1,579 @@
+//======================================================================
+//
+// tb_sha512.v
+// -----------
+// Testbench for the SHA-512 core, using the single and two block
+// test vectors from FIPS 180-2.
+//
+//
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+//======================================================================
+
+`default_nettype none
+
+module tb_sha512 ();
+
+  //----------------------------------------------------------------
+  // Internal constant and parameter definitions.
+  //----------------------------------------------------------------
+  parameter DEBUG = 0;
+
+  parameter CLK_HALF_PERIOD = 1;
+  parameter CLK_PERIOD = 2 * CLK_HALF_PERIOD;
+
+  localparam ADDR_NAME0 = 8'h00;
+  localparam ADDR_NAME1 = 8'h01;
+  localparam ADDR_VERSION = 8'h02;
+
+  localparam ADDR_CTRL = 8'h08;
+  localparam CTRL_NEXT_BIT = 0;
+
+  localparam ADDR_STATUS = 8'h09;
+  localparam STATUS_READY_BIT = 0;
+
+  localparam ADDR_BLOCK0 = 8'h20;
+  localparam ADDR_H0 = 8'h40;
+
+  // Documented latency of a block, and the slack the status polling
+  // in the tb adds around it.
+  localparam BLOCK_CYCLES = 82;
+  localparam POLL_SLACK = 2;
+
+  localparam H_INIT = {
+    64'h6a09e667f3bcc908,
+    64'hbb67ae8584caa73b,
+    64'h3c6ef372fe94f82b,
+    64'ha54ff53a5f1d36f1,
+    64'h510e527fade682d1,
+    64'h9b05688c2b3e6c1f,
+    64'h1f83d9abfb41bd6b,
+    64'h5be0cd19137e2179
+  };
+
+
+  //----------------------------------------------------------------
+  // Register and Wire declarations.
+  //----------------------------------------------------------------
+  reg  [  31 : 0] cycle_ctr;
+  reg  [  31 : 0] error_ctr;
+  reg  [  31 : 0] tc_ctr;
+  reg             tb_monitor;
+
+  reg             tb_clk;
+  reg             tb_reset_n;
+  reg             tb_cs;
+  reg             tb_we;
+  reg  [   7 : 0] tb_address;
+  reg  [  31 : 0] tb_write_data;
+  wire [  31 : 0] tb_read_data;
+  wire            tb_ready;
+
+  reg  [  31 : 0] read_data;
+  reg  [ 511 : 0] digest;
+
+
+  //----------------------------------------------------------------
+  // Device Under Test.
+  //----------------------------------------------------------------
+  sha512 dut (
+      .clk(tb_clk),
+      .reset_n(tb_reset_n),
+
+      .cs(tb_cs),
+      .we(tb_we),
+      .address(tb_address),
+      .write_data(tb_write_data),
+      .read_data(tb_read_data),
+      .ready(tb_ready)
+  );
+
+
+  //----------------------------------------------------------------
+  // clk_gen
+  //
+  // Always running clock generator process.
+  //----------------------------------------------------------------
+  always begin : clk_gen
+    #CLK_HALF_PERIOD;
+    tb_clk = !tb_clk;
+  end  // clk_gen
+
+
+  //----------------------------------------------------------------
+  // sys_monitor()
+  //
+  // An always running process that creates a cycle counter and
+  // conditionally displays information about the DUT.
+  //----------------------------------------------------------------
+  always begin : sys_monitor
+    cycle_ctr = cycle_ctr + 1;
+    #(CLK_PERIOD);
+    if (tb_monitor) begin
+      dump_dut_state();
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // dump_dut_state()
+  //
+  // Dump the state of the dump when needed.
+  //----------------------------------------------------------------
+  task dump_dut_state;
+    begin
+      $display("State of DUT");
+      $display("------------");
+      $display("Cycle: %08d", cycle_ctr);
+      $display("");
+      $display("Inputs and outputs:");
+      $display(
+          "cs: 0x%1x, we: 0x%1x, address: 0x%02x, write_data: 0x%08x, read_data: 0x%08x, ready: 0x%1x",
+          tb_cs, tb_we, tb_address, tb_write_data, tb_read_data, tb_ready);
+      $display("");
+      $display("Internal state:");
+      $display("ctrl: 0x%1x, round: 0x%02x, ready: 0x%1x", dut.core.sha512_ctrl_reg,
+               dut.core.round_ctr_reg, dut.core.ready_reg);
+      $display("a: 0x%016x, e: 0x%016x, hkw: 0x%016x, w0: 0x%016x", dut.core.a_reg,
+               dut.core.e_reg, dut.core.hkw_reg, dut.core.w_reg[0]);
+      $display("");
+      $display("");
+    end
+  endtask  // dump_dut_state
+
+
+  //----------------------------------------------------------------
+  // reset_dut()
+  //
+  // Toggle reset to put the DUT into a well known state.
+  //----------------------------------------------------------------
+  task reset_dut;
+    begin
+      $display("--- Toggle reset.");
+      tb_reset_n = 0;
+      #(2 * CLK_PERIOD);
+      tb_reset_n = 1;
+    end
+  endtask  // reset_dut
+
+
+  //----------------------------------------------------------------
+  // display_test_result()
+  //
+  // Display the accumulated test results.
+  //----------------------------------------------------------------
+  task display_test_result;
+    begin
+      if (error_ctr == 0) begin
+        $display("--- All %02d test cases completed successfully", tc_ctr);
+      end
+      else begin
+        $display("--- %02d tests completed - %02d test cases did not complete successfully.",
+                 tc_ctr, error_ctr);
+      end
+    end
+  endtask  // display_test_result
+
+
+  //----------------------------------------------------------------
+  // init_sim()
+  //
+  // Initialize all counters and testbed functionality as well
+  // as setting the DUT inputs to defined values.
+  //----------------------------------------------------------------
+  task init_sim;
+    begin
+      cycle_ctr     = 0;
+      error_ctr     = 0;
+      tc_ctr        = 0;
+      tb_monitor    = 0;
+
+      tb_clk        = 1'h0;
+      tb_reset_n    = 1'h1;
+      tb_cs         = 1'h0;
+      tb_we         = 1'h0;
+      tb_address    = 8'h0;
+      tb_write_data = 32'h0;
+    end
+  endtask  // init_sim
+
+
+  //----------------------------------------------------------------
+  // write_word()
+  //
+  // Write the given word to the DUT using the DUT interface.
+  //----------------------------------------------------------------
+  task write_word(input [7 : 0] address, input [31 : 0] word);
+    begin
+      if (DEBUG) begin
+        $display("--- Writing 0x%08x to 0x%02x.", word, address);
+        $display("");
+      end
+
+      tb_address = address;
+      tb_write_data = word;
+      tb_cs = 1;
+      tb_we = 1;
+      #(CLK_PERIOD);
+      tb_cs = 0;
+      tb_we = 0;
+    end
+  endtask  // write_word
+
+
+  //----------------------------------------------------------------
+  // read_word()
+  //
+  // Read a data word from the given address in the DUT.
+  // the word read will be available in the global variable
+  // read_data.
+  //----------------------------------------------------------------
+  task read_word(input [7 : 0] address);
+    begin
+      tb_address = address;
+      tb_cs = 1;
+      tb_we = 0;
+      #(CLK_PERIOD);
+      read_data = tb_read_data;
+      tb_cs = 0;
+
+      if (DEBUG) begin
+        $display("--- Reading 0x%08x from 0x%02x.", read_data, address);
+        $display("");
+      end
+    end
+  endtask  // read_word
+
+
+  //----------------------------------------------------------------
+  // check_word()
+  //
+  // Read a word and compare it to the expected value.
+  //----------------------------------------------------------------
+  task check_word(input [7 : 0] address, input [31 : 0] expected);
+    begin
+      read_word(address);
+      if (read_data != expected) begin
+        $display("--- Error: Got 0x%08x from 0x%02x, expected 0x%08x.", read_data, address,
+                 expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_word
+
+
+  //----------------------------------------------------------------
+  // wait_ready()
+  //
+  // Wait for the ready flag to be set in dut.
+  //----------------------------------------------------------------
+  task wait_ready;
+    begin : wready
+      read_word(ADDR_STATUS);
+      while (read_data[STATUS_READY_BIT] == 0) read_word(ADDR_STATUS);
+    end
+  endtask  // wait_ready
+
+
+  //----------------------------------------------------------------
+  // write_h()
+  //
+  // Write the given chaining value, first word first.
+  //----------------------------------------------------------------
+  task write_h(input [511 : 0] h);
+    begin : write_h
+      integer i;
+
+      for (i = 0; i < 16; i = i + 1) begin
+        write_word(ADDR_H0 + i[7 : 0], h[(511-i*32)-:32]);
+      end
+    end
+  endtask  // write_h
+
+
+  //----------------------------------------------------------------
+  // compress_block()
+  //
+  // Write the block, first word first, compress it and read out
+  // the chaining value into digest.
+  //----------------------------------------------------------------
+  task compress_block(input [1023 : 0] block);
+    begin : compress_block
+      integer i;
+
+      for (i = 0; i < 32; i = i + 1) begin
+        write_word(ADDR_BLOCK0 + i[7 : 0], block[(1023-i*32)-:32]);
+      end
+
+      write_word(ADDR_CTRL, 32'h1 << CTRL_NEXT_BIT);
+      wait_ready();
+
+      for (i = 0; i < 16; i = i + 1) begin
+        read_word(ADDR_H0 + i[7 : 0]);
+        digest[(511-i*32)-:32] = read_data;
+      end
+    end
+  endtask  // compress_block
+
+
+  //----------------------------------------------------------------
+  // check_digest()
+  //----------------------------------------------------------------
+  task check_digest(input [511 : 0] expected);
+    begin
+      if (digest == expected) begin
+        $display("--- Correct digest.");
+      end
+      else begin
+        $display("--- Error: Got digest 0x%0128x", digest);
+        $display("--- expected 0x%0128x", expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_digest
+
+
+  //----------------------------------------------------------------
+  // test1()
+  // Read the name and version of the core.
+  //----------------------------------------------------------------
+  task test1;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test1: started.");
+
+      check_word(ADDR_NAME0, 32'h73686135);
+      check_word(ADDR_NAME1, 32'h31322020);
+      check_word(ADDR_VERSION, 32'h00000001);
+      check_word(ADDR_STATUS, 32'h00000001);
+
+      $display("--- test1: completed.");
+      $display("");
+    end
+  endtask  // test1
+
+
+  //----------------------------------------------------------------
+  // test2()
+  // The single block message "abc". Check that a compression
+  // takes the documented number of cycles.
+  //----------------------------------------------------------------
+  task test2;
+    begin : test2
+      reg [31 : 0] start_cycle;
+      reg [31 : 0] cycles;
+
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test2: started.");
+
+      write_h(H_INIT);
+      compress_block(
+          {
+            64'h6162638000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000018
+          });
+      check_digest(
+          {
+            64'hddaf35a193617aba,
+            64'hcc417349ae204131,
+            64'h12e6fa4e89a97ea2,
+            64'h0a9eeee64b55d39a,
+            64'h2192992a274fc1a8,
+            64'h36ba3c23a3feebbd,
+            64'h454d4423643ce80e,
+            64'h2a9ac94fa54ca49f
+          });
+
+      write_word(ADDR_CTRL, 32'h1 << CTRL_NEXT_BIT);
+      start_cycle = cycle_ctr;
+      wait_ready();
+      cycles = cycle_ctr - start_cycle;
+      $display("--- test2: One block in %0d cycles.", cycles);
+
+      if ((cycles + POLL_SLACK < BLOCK_CYCLES) || (cycles > BLOCK_CYCLES + POLL_SLACK)) begin
+        $display("--- Error: Expected %0d cycles per block.", BLOCK_CYCLES);
+        error_ctr = error_ctr + 1;
+      end
+
+      $display("--- test2: completed.");
+      $display("");
+    end
+  endtask  // test2
+
+
+  //----------------------------------------------------------------
+  // test3()
+  // The two block message
+  // "abcdefghbcdefghi...nopqrstu". Check the chaining value after
+  // both blocks.
+  //----------------------------------------------------------------
+  task test3;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test3: started.");
+
+      write_h(H_INIT);
+      compress_block(
+          {
+            64'h6162636465666768,
+            64'h6263646566676869,
+            64'h636465666768696a,
+            64'h6465666768696a6b,
+            64'h65666768696a6b6c,
+            64'h666768696a6b6c6d,
+            64'h6768696a6b6c6d6e,
+            64'h68696a6b6c6d6e6f,
+            64'h696a6b6c6d6e6f70,
+            64'h6a6b6c6d6e6f7071,
+            64'h6b6c6d6e6f707172,
+            64'h6c6d6e6f70717273,
+            64'h6d6e6f7071727374,
+            64'h6e6f707172737475,
+            64'h8000000000000000,
+            64'h0000000000000000
+          });
+      check_digest(
+          {
+            64'h4319017a2b706e69,
+            64'hcd4b05938bae5e89,
+            64'h0186bf199f30aa95,
+            64'h6ef8b71d2f810585,
+            64'hd787d6764b20bda2,
+            64'ha260144709736920,
+            64'h00ec057f37d14b8e,
+            64'h06add5b50e671c72
+          });
+
+      compress_block(
+          {
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000000,
+            64'h0000000000000380
+          });
+      check_digest(
+          {
+            64'h8e959b75dae313da,
+            64'h8cf4f72814fc143f,
+            64'h8f7779c6eb9f7fa1,
+            64'h7299aeadb6889018,
+            64'h501d289e4900f7e4,
+            64'h331b99dec4b5433a,
+            64'hc7d329eeb6dd2654,
+            64'h5e96e55b874be909
+          });
+
+      $display("--- test3: completed.");
+      $display("");
+    end
+  endtask  // test3
+
+
+  //----------------------------------------------------------------
+  // test4()
+  // Check that the chaining value can't be changed while the core
+  // is busy.
+  //----------------------------------------------------------------
+  task test4;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test4: started.");
+
+      write_word(ADDR_H0, 32'h0);
+      write_word(ADDR_CTRL, 32'h1 << CTRL_NEXT_BIT);
+      check_word(ADDR_STATUS, 32'h0);
+      write_word(ADDR_H0, 32'hdeadbeef);
+      wait_ready();
+
+      read_word(ADDR_H0);
+      if (read_data == 32'hdeadbeef) begin
+        $display("--- Error: Chaining value written while busy.");
+        error_ctr = error_ctr + 1;
+      end
+
+      $display("--- test4: completed.");
+      $display("");
+    end
+  endtask  // test4
+
+
+  //----------------------------------------------------------------
+  // exit_with_error_code()
+  //
+  // Exit with the right error code
+  //----------------------------------------------------------------
+  task exit_with_error_code;
+    begin
+      if (error_ctr == 0) begin
+        $finish(0);
+      end
+      else begin
+        $fatal(1);
+      end
+    end
+  endtask  // exit_with_error_code
+
+
+  //----------------------------------------------------------------
+  // sha512_test
+  //----------------------------------------------------------------
+  initial begin : sha512_test
+    $display("");
+    $display("   -= Testbench for sha512 started =-");
+    $display("     ==============================");
+    $display("");
+
+    init_sim();
+    reset_dut();
+    test1();
+    test2();
+    test3();
+    test4();
+
+    display_test_result();
+    $display("");
+    $display("   -= Testbench for sha512 completed =-");
+    $display("     ================================");
+    $display("");
+    exit_with_error_code();
+  end  // sha512_test
+endmodule  // tb_sha512
+
+//======================================================================
+// EOF tb_sha512.v
+//======================================================================
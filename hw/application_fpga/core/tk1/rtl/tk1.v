@@ -32,9 +32,22 @@ module tk1 #(
     output wire [14 : 0] ram_addr_rand,
     output wire [31 : 0] ram_data_rand,
 
+    output wire [31 : 0] ram_fill_data,
+    output wire          ram_fill_state_we,
+    output wire          ram_fill_acc_we,
+    output wire          ram_fill_start,
+    input  wire          ram_fill_busy,
+
+    output wire          spi_dma_ram_req,
+    output wire [14 : 0] spi_dma_ram_address,
+    output wire [31 : 0] spi_dma_ram_write_data,
+    input  wire          spi_dma_ram_ack,
+
     output wire spi_ss,
     output wire spi_sck,
     output wire spi_mosi,
+    output wire spi_mosi_en,
+    input  wire spi_io0,
     input  wire spi_miso,
 
     output wire led_r,
@@ -88,6 +101,10 @@ module tk1 #(
 
   localparam ADDR_RAM_ADDR_RAND = 8'h40;
   localparam ADDR_RAM_DATA_RAND = 8'h41;
+  localparam ADDR_RAM_FILL_STATE = 8'h42;
+  localparam ADDR_RAM_FILL_ACC = 8'h43;
+  localparam ADDR_RAM_FILL = 8'h44;
+  localparam RAM_FILL_BUSY_BIT = 0;
 
   localparam ADDR_CPU_MON_CTRL = 8'h60;
   localparam ADDR_CPU_MON_FIRST = 8'h61;
@@ -98,10 +115,14 @@ module tk1 #(
   localparam ADDR_SPI_EN = 8'h80;
   localparam ADDR_SPI_XFER = 8'h81;
   localparam ADDR_SPI_DATA = 8'h82;
+  localparam ADDR_SPI_BURST = 8'h83;
+  localparam ADDR_SPI_DMA_DST = 8'h84;
+  localparam ADDR_SPI_DMA_LEN = 8'h85;
+  localparam ADDR_SPI_MODE = 8'h86;
 
   localparam TK1_NAME0 = 32'h746B3120;  // "tk1 "
   localparam TK1_NAME1 = 32'h6d6b6466;  // "mkdf"
-  localparam TK1_VERSION = 32'h00000006;
+  localparam TK1_VERSION = 32'h00000007;
 
   localparam FW_RAM_FIRST = 32'hd0000000;
   localparam FW_RAM_LAST = 32'hd0000fff;  // 4 KB
@@ -157,6 +178,21 @@ module tk1 #(
   reg           force_trap_reg;
   reg           force_trap_set;
 
+  reg  [14 : 0] spi_dma_dst_reg;
+  reg  [14 : 0] spi_dma_dst_new;
+  reg           spi_dma_dst_we;
+  reg  [15 : 0] spi_dma_len_reg;
+  reg  [15 : 0] spi_dma_len_new;
+  reg           spi_dma_len_we;
+  reg  [31 : 0] spi_dma_word_reg;
+  reg           spi_dma_word_we;
+  reg           spi_dma_full_reg;
+  reg           spi_dma_full_new;
+  reg           spi_dma_full_we;
+  reg           spi_dma_xfer_reg;
+  reg           spi_dma_xfer_new;
+  reg           spi_dma_xfer_we;
+
 
   //----------------------------------------------------------------
   // Wires.
@@ -177,6 +213,19 @@ module tk1 #(
   reg           spi_tx_data_vld;
   wire          spi_ready;
   wire [ 7 : 0] spi_rx_data;
+  reg           spi_burst_start;
+  reg  [31 : 0] spi_tx_word;
+  wire [31 : 0] spi_rx_word;
+  reg           spi_dma_burst_start;
+  reg           spi_dma_dst_set;
+  reg           spi_dma_len_set;
+  reg           spi_dual;
+  reg           spi_dual_vld;
+  wire          spi_dual_mode;
+
+  reg           tmp_ram_fill_state_we;
+  reg           tmp_ram_fill_acc_we;
+  reg           tmp_ram_fill_start;
 
   //----------------------------------------------------------------
   // Concurrent connectivity for ports etc.
@@ -195,8 +244,17 @@ module tk1 #(
   assign ram_addr_rand   = ram_addr_rand_reg;
   assign ram_data_rand   = ram_data_rand_reg;
 
+  assign ram_fill_data     = write_data;
+  assign ram_fill_state_we = tmp_ram_fill_state_we;
+  assign ram_fill_acc_we   = tmp_ram_fill_acc_we;
+  assign ram_fill_start    = tmp_ram_fill_start;
+
   assign system_reset    = system_reset_reg;
 
+  assign spi_dma_ram_req        = spi_dma_full_reg & (|spi_dma_len_reg) & ~app_mode;
+  assign spi_dma_ram_address    = spi_dma_dst_reg;
+  assign spi_dma_ram_write_data = spi_dma_word_reg;
+
   //----------------------------------------------------------------
   // Module instance.
   //----------------------------------------------------------------
@@ -225,6 +283,8 @@ module tk1 #(
       .spi_ss  (spi_ss),
       .spi_sck (spi_sck),
       .spi_mosi(spi_mosi),
+      .spi_mosi_en(spi_mosi_en),
+      .spi_io0(spi_io0),
       .spi_miso(spi_miso),
 
       .spi_enable(spi_enable),
@@ -233,6 +293,12 @@ module tk1 #(
       .spi_tx_data(spi_tx_data),
       .spi_tx_data_vld(spi_tx_data_vld),
       .spi_rx_data(spi_rx_data),
+      .spi_burst_start(spi_burst_start | spi_dma_burst_start),
+      .spi_tx_word(spi_dma_burst_start ? 32'h0 : spi_tx_word),
+      .spi_rx_word(spi_rx_word),
+      .spi_dual(spi_dual),
+      .spi_dual_vld(spi_dual_vld),
+      .spi_dual_mode(spi_dual_mode),
       .spi_ready(spi_ready)
   );
 
@@ -272,6 +338,11 @@ module tk1 #(
       ram_data_rand_reg   <= 32'h0;
       force_trap_reg      <= 1'h0;
       system_reset_reg    <= 1'h0;
+      spi_dma_dst_reg     <= 15'h0;
+      spi_dma_len_reg     <= 16'h0;
+      spi_dma_word_reg    <= 32'h0;
+      spi_dma_full_reg    <= 1'h0;
+      spi_dma_xfer_reg    <= 1'h0;
     end
 
     else begin
@@ -340,6 +411,26 @@ module tk1 #(
       if (force_trap_set) begin
         force_trap_reg <= 1'h1;
       end
+
+      if (spi_dma_dst_we) begin
+        spi_dma_dst_reg <= spi_dma_dst_new;
+      end
+
+      if (spi_dma_len_we) begin
+        spi_dma_len_reg <= spi_dma_len_new;
+      end
+
+      if (spi_dma_word_we) begin
+        spi_dma_word_reg <= spi_rx_word;
+      end
+
+      if (spi_dma_full_we) begin
+        spi_dma_full_reg <= spi_dma_full_new;
+      end
+
+      if (spi_dma_xfer_we) begin
+        spi_dma_xfer_reg <= spi_dma_xfer_new;
+      end
     end
   end  // reg_update
 
@@ -367,6 +458,68 @@ module tk1 #(
   end
 
 
+  //----------------------------------------------------------------
+  // spi_dma
+  //
+  // Moves words from the SPI-master straight into RAM. SW sends
+  // the read command and address to the memory as usual, then
+  // sets the RAM destination and starts the DMA by setting the
+  // number of words to read. Each word is read with a burst and
+  // written to RAM in a cycle where the CPU is not accessing the
+  // RAM. The DMA is stopped when leaving firmware mode.
+  //----------------------------------------------------------------
+  always @* begin : spi_dma
+    spi_dma_dst_new     = spi_dma_dst_reg + 1'h1;
+    spi_dma_dst_we      = 1'h0;
+    spi_dma_len_new     = spi_dma_len_reg - 1'h1;
+    spi_dma_len_we      = 1'h0;
+    spi_dma_word_we     = 1'h0;
+    spi_dma_full_new    = 1'h0;
+    spi_dma_full_we     = 1'h0;
+    spi_dma_xfer_new    = 1'h0;
+    spi_dma_xfer_we     = 1'h0;
+    spi_dma_burst_start = 1'h0;
+
+    if (spi_dma_full_reg && spi_dma_ram_ack) begin
+      spi_dma_dst_we  = 1'h1;
+      spi_dma_len_we  = 1'h1;
+      spi_dma_full_we = 1'h1;
+    end
+
+    if (spi_dma_xfer_reg && spi_ready) begin
+      spi_dma_word_we  = 1'h1;
+      spi_dma_full_new = 1'h1;
+      spi_dma_full_we  = 1'h1;
+      spi_dma_xfer_we  = 1'h1;
+    end
+
+    if ((|spi_dma_len_reg) && !spi_dma_full_reg && !spi_dma_xfer_reg && spi_ready) begin
+      spi_dma_burst_start = 1'h1;
+      spi_dma_xfer_new    = 1'h1;
+      spi_dma_xfer_we     = 1'h1;
+    end
+
+    if (spi_dma_dst_set) begin
+      spi_dma_dst_new = write_data[16 : 2];
+      spi_dma_dst_we  = 1'h1;
+    end
+
+    if (spi_dma_len_set) begin
+      spi_dma_len_new  = write_data[15 : 0];
+      spi_dma_len_we   = 1'h1;
+      spi_dma_full_new = 1'h0;
+      spi_dma_full_we  = 1'h1;
+    end
+
+    if (app_mode) begin
+      spi_dma_len_new  = 16'h0;
+      spi_dma_len_we   = 1'h1;
+      spi_dma_full_new = 1'h0;
+      spi_dma_full_we  = 1'h1;
+    end
+  end
+
+
   //----------------------------------------------------------------
   // security_monitor
   //
@@ -432,8 +585,23 @@ module tk1 #(
           force_trap_set = 1'h1;
         end
 
+        // Outside BLAKE2S
+        if (cpu_addr[29 : 24] == 6'h05 & |cpu_addr[23 : 10]) begin
+          force_trap_set = 1'h1;
+        end
+
+        // Outside SHA512
+        if (cpu_addr[29 : 24] == 6'h06 & |cpu_addr[23 : 10]) begin
+          force_trap_set = 1'h1;
+        end
+
+        // Outside FE25519
+        if (cpu_addr[29 : 24] == 6'h07 & |cpu_addr[23 : 10]) begin
+          force_trap_set = 1'h1;
+        end
+
         // In unused space
-        if ((cpu_addr[29 : 24] > 6'h04) && (cpu_addr[29 : 24] < 6'h10)) begin
+        if ((cpu_addr[29 : 24] > 6'h07) && (cpu_addr[29 : 24] < 6'h10)) begin
           force_trap_set = 1'h1;
         end
 
@@ -511,6 +679,9 @@ module tk1 #(
     ram_addr_rand_we = 1'h0;
     ram_data_rand_we = 1'h0;
     system_reset_new = 1'h0;
+    tmp_ram_fill_state_we = 1'h0;
+    tmp_ram_fill_acc_we   = 1'h0;
+    tmp_ram_fill_start    = 1'h0;
     cpu_mon_en_we    = 1'h0;
     cpu_mon_first_we = 1'h0;
     cpu_mon_last_we  = 1'h0;
@@ -520,9 +691,15 @@ module tk1 #(
     spi_enable_vld   = 1'h0;
     spi_start        = 1'h0;
     spi_tx_data_vld  = 1'h0;
+    spi_burst_start  = 1'h0;
+    spi_dma_dst_set  = 1'h0;
+    spi_dma_len_set  = 1'h0;
+    spi_dual_vld     = 1'h0;
 
     spi_enable       = write_data[0] & !app_mode;
+    spi_dual         = write_data[0] & !app_mode;
     spi_tx_data      = write_data[7 : 0] & {8{!app_mode}};
+    spi_tx_word      = write_data & {32{!app_mode}};
 
     if (cs) begin
       tmp_ready = 1'h1;
@@ -572,6 +749,24 @@ module tk1 #(
           end
         end
 
+        if (address == ADDR_RAM_FILL_STATE) begin
+          if (!app_mode) begin
+            tmp_ram_fill_state_we = 1'h1;
+          end
+        end
+
+        if (address == ADDR_RAM_FILL_ACC) begin
+          if (!app_mode) begin
+            tmp_ram_fill_acc_we = 1'h1;
+          end
+        end
+
+        if (address == ADDR_RAM_FILL) begin
+          if (!app_mode) begin
+            tmp_ram_fill_start = 1'h1;
+          end
+        end
+
         if (address == ADDR_CPU_MON_CTRL) begin
           cpu_mon_en_we = 1'h1;
         end
@@ -606,6 +801,30 @@ module tk1 #(
           end
         end
 
+        if (address == ADDR_SPI_BURST) begin
+          if (!app_mode) begin
+            spi_burst_start = 1'h1;
+          end
+        end
+
+        if (address == ADDR_SPI_DMA_DST) begin
+          if (!app_mode) begin
+            spi_dma_dst_set = 1'h1;
+          end
+        end
+
+        if (address == ADDR_SPI_DMA_LEN) begin
+          if (!app_mode) begin
+            spi_dma_len_set = 1'h1;
+          end
+        end
+
+        if (address == ADDR_SPI_MODE) begin
+          if (!app_mode) begin
+            spi_dual_vld = 1'h1;
+          end
+        end
+
       end
       else begin
         if (address == ADDR_NAME0) begin
@@ -646,6 +865,10 @@ module tk1 #(
           end
         end
 
+        if (address == ADDR_RAM_FILL) begin
+          tmp_read_data[RAM_FILL_BUSY_BIT] = ram_fill_busy;
+        end
+
         if (address == ADDR_SPI_XFER) begin
           if (!app_mode) begin
             tmp_read_data[0] = spi_ready;
@@ -658,6 +881,30 @@ module tk1 #(
           end
         end
 
+        if (address == ADDR_SPI_BURST) begin
+          if (!app_mode) begin
+            tmp_read_data = spi_rx_word;
+          end
+        end
+
+        if (address == ADDR_SPI_DMA_DST) begin
+          if (!app_mode) begin
+            tmp_read_data = {15'h0, spi_dma_dst_reg, 2'h0};
+          end
+        end
+
+        if (address == ADDR_SPI_DMA_LEN) begin
+          if (!app_mode) begin
+            tmp_read_data = {16'h0, spi_dma_len_reg};
+          end
+        end
+
+        if (address == ADDR_SPI_MODE) begin
+          if (!app_mode) begin
+            tmp_read_data[0] = spi_dual_mode;
+          end
+        end
+
       end
     end
   end  // api
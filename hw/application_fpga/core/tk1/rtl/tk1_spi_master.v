@@ -14,6 +14,16 @@
 // just prior to settint the positive clock flank at the start
 // of a byte transfer.
 //
+// The master can also do a burst of four bytes in one go. The
+// bytes to send are given as a word, least significant byte first,
+// and the received bytes are collected into a word in the same
+// order.
+//
+// In dual mode, used for the Dual Output Fast Read command, the
+// master stops driving MOSI and receives two bits per clock, the
+// odd bits on MISO and the even bits on MOSI. A byte then takes
+// four clocks. Dual mode is left when the master is disabled.
+//
 //
 // Author: Joachim Strombergson
 // SPDX-FileCopyrightText: 2023 Tillitis AB <tillitis.se>
@@ -30,15 +40,23 @@ module tk1_spi_master (
     output wire spi_ss,
     output wire spi_sck,
     output wire spi_mosi,
+    output wire spi_mosi_en,
+    input  wire spi_io0,
     input  wire spi_miso,
 
-    input  wire         spi_enable,
-    input  wire         spi_enable_vld,
-    input  wire         spi_start,
-    input  wire [7 : 0] spi_tx_data,
-    input  wire         spi_tx_data_vld,
-    output wire [7 : 0] spi_rx_data,
-    output wire         spi_ready
+    input  wire          spi_enable,
+    input  wire          spi_enable_vld,
+    input  wire          spi_start,
+    input  wire [ 7 : 0] spi_tx_data,
+    input  wire          spi_tx_data_vld,
+    output wire [ 7 : 0] spi_rx_data,
+    input  wire          spi_burst_start,
+    input  wire [31 : 0] spi_tx_word,
+    output wire [31 : 0] spi_rx_word,
+    input  wire          spi_dual,
+    input  wire          spi_dual_vld,
+    output wire          spi_dual_mode,
+    output wire          spi_ready
 );
 
 
@@ -63,6 +81,7 @@ module tk1_spi_master (
   reg [7 : 0] spi_tx_data_reg;
   reg [7 : 0] spi_tx_data_new;
   reg         spi_tx_data_nxt;
+  reg         spi_tx_data_ld;
   reg         spi_tx_data_we;
 
   reg [7 : 0] spi_rx_data_reg;
@@ -70,7 +89,18 @@ module tk1_spi_master (
   reg         spi_rx_data_nxt;
   reg         spi_rx_data_we;
 
+  reg [23 : 0] spi_tx_word_reg;
+  reg [23 : 0] spi_tx_word_new;
+  reg          spi_tx_word_we;
+
+  reg [31 : 0] spi_rx_word_reg;
+  reg [31 : 0] spi_rx_word_new;
+  reg          spi_rx_word_we;
+
   reg         spi_miso_sample_reg;
+  reg         spi_io0_sample_reg;
+
+  reg         spi_dual_reg;
 
   reg [2 : 0] spi_bit_ctr_reg;
   reg [2 : 0] spi_bit_ctr_new;
@@ -78,6 +108,16 @@ module tk1_spi_master (
   reg         spi_bit_ctr_inc;
   reg         spi_bit_ctr_we;
 
+  reg [1 : 0] spi_byte_ctr_reg;
+  reg [1 : 0] spi_byte_ctr_new;
+  reg         spi_byte_ctr_rst;
+  reg         spi_byte_ctr_inc;
+  reg         spi_byte_ctr_we;
+
+  reg         spi_burst_reg;
+  reg         spi_burst_new;
+  reg         spi_burst_we;
+
   reg         spi_ready_reg;
   reg         spi_ready_new;
   reg         spi_ready_we;
@@ -87,14 +127,23 @@ module tk1_spi_master (
   reg         spi_ctrl_we;
 
 
+  //----------------------------------------------------------------
+  // Wires.
+  //----------------------------------------------------------------
+  reg [7 : 0] spi_rx_shift;
+
+
   //----------------------------------------------------------------
   // Concurrent connectivity for ports etc.
   //----------------------------------------------------------------
-  assign spi_ss      = spi_ss_reg;
-  assign spi_sck     = spi_csk_reg;
-  assign spi_mosi    = spi_tx_data_reg[7];
-  assign spi_rx_data = spi_rx_data_reg;
-  assign spi_ready   = spi_ready_reg;
+  assign spi_ss        = spi_ss_reg;
+  assign spi_sck       = spi_csk_reg;
+  assign spi_mosi      = spi_tx_data_reg[7];
+  assign spi_mosi_en   = ~spi_dual_reg;
+  assign spi_rx_data   = spi_rx_data_reg;
+  assign spi_rx_word   = spi_rx_word_reg;
+  assign spi_dual_mode = spi_dual_reg;
+  assign spi_ready     = spi_ready_reg;
 
 
   //----------------------------------------------------------------
@@ -105,20 +154,35 @@ module tk1_spi_master (
       spi_ss_reg          <= 1'h1;
       spi_csk_reg         <= 1'h0;
       spi_miso_sample_reg <= 1'h0;
+      spi_io0_sample_reg  <= 1'h0;
+      spi_dual_reg        <= 1'h0;
       spi_tx_data_reg     <= 8'h0;
       spi_rx_data_reg     <= 8'h0;
+      spi_tx_word_reg     <= 24'h0;
+      spi_rx_word_reg     <= 32'h0;
       spi_bit_ctr_reg     <= 3'h0;
+      spi_byte_ctr_reg    <= 2'h0;
+      spi_burst_reg       <= 1'h0;
       spi_ready_reg       <= 1'h1;
       spi_ctrl_reg        <= CTRL_IDLE;
     end
 
     else begin
       spi_miso_sample_reg <= spi_miso;
+      spi_io0_sample_reg  <= spi_io0;
 
       if (spi_enable_vld) begin
         spi_ss_reg <= ~spi_enable;
       end
 
+      if (spi_dual_vld) begin
+        spi_dual_reg <= spi_dual;
+      end
+
+      if (spi_enable_vld && !spi_enable) begin
+        spi_dual_reg <= 1'h0;
+      end
+
       if (spi_csk_we) begin
         spi_csk_reg <= spi_csk_new;
       end
@@ -131,6 +195,22 @@ module tk1_spi_master (
         spi_rx_data_reg <= spi_rx_data_new;
       end
 
+      if (spi_tx_word_we) begin
+        spi_tx_word_reg <= spi_tx_word_new;
+      end
+
+      if (spi_rx_word_we) begin
+        spi_rx_word_reg <= spi_rx_word_new;
+      end
+
+      if (spi_byte_ctr_we) begin
+        spi_byte_ctr_reg <= spi_byte_ctr_new;
+      end
+
+      if (spi_burst_we) begin
+        spi_burst_reg <= spi_burst_new;
+      end
+
       if (spi_ready_we) begin
         spi_ready_reg <= spi_ready_new;
       end
@@ -165,6 +245,25 @@ module tk1_spi_master (
   end
 
 
+  //----------------------------------------------------------------
+  // byte_ctr
+  //----------------------------------------------------------------
+  always @* begin : byte_ctr
+    spi_byte_ctr_new = 2'h0;
+    spi_byte_ctr_we  = 1'h0;
+
+    if (spi_byte_ctr_rst) begin
+      spi_byte_ctr_new = 2'h0;
+      spi_byte_ctr_we  = 1'h1;
+    end
+
+    else if (spi_byte_ctr_inc) begin
+      spi_byte_ctr_new = spi_byte_ctr_reg + 1'h1;
+      spi_byte_ctr_we  = 1'h1;
+    end
+  end
+
+
   //----------------------------------------------------------------
   // spi_tx_data_logic
   //
@@ -182,10 +281,63 @@ module tk1_spi_master (
       end
     end
 
+    if (spi_burst_start) begin
+      if (spi_ready_reg) begin
+        spi_tx_data_new = spi_tx_word[7 : 0];
+        spi_tx_data_we  = 1'h1;
+      end
+    end
+
     if (spi_tx_data_nxt) begin
       spi_tx_data_new = {spi_tx_data_reg[6 : 0], 1'h0};
       spi_tx_data_we  = 1'h1;
     end
+
+    if (spi_tx_data_ld) begin
+      spi_tx_data_new = spi_tx_word_reg[7 : 0];
+      spi_tx_data_we  = 1'h1;
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // spi_tx_word_logic
+  //
+  // Holds the bytes left to send in a burst. The next byte
+  // is loaded into the tx_data shift register when the
+  // previous byte has been sent.
+  //----------------------------------------------------------------
+  always @* begin : spi_tx_word_logic
+    spi_tx_word_new = 24'h0;
+    spi_tx_word_we  = 1'h0;
+
+    if (spi_burst_start) begin
+      if (spi_ready_reg) begin
+        spi_tx_word_new = spi_tx_word[31 : 8];
+        spi_tx_word_we  = 1'h1;
+      end
+    end
+
+    if (spi_tx_data_ld) begin
+      spi_tx_word_new = {8'h0, spi_tx_word_reg[23 : 8]};
+      spi_tx_word_we  = 1'h1;
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // spi_rx_shift_logic
+  //
+  // The rx_data register with the bits sampled in this clock
+  // shifted in. Two bits per clock in dual mode.
+  //----------------------------------------------------------------
+  always @* begin : spi_rx_shift_logic
+    if (spi_dual_reg) begin
+      spi_rx_shift = {spi_rx_data_reg[5 : 0], spi_miso_sample_reg, spi_io0_sample_reg};
+    end
+    else begin
+      spi_rx_shift = {spi_rx_data_reg[6 : 0], spi_miso_sample_reg};
+    end
   end
 
 
@@ -203,37 +355,58 @@ module tk1_spi_master (
     end
 
     else if (spi_rx_data_nxt) begin
-      spi_rx_data_new = {spi_rx_data_reg[6 : 0], spi_miso_sample_reg};
+      spi_rx_data_new = spi_rx_shift;
       spi_rx_data_we  = 1'h1;
     end
   end
 
 
+  //----------------------------------------------------------------
+  // spi_rx_word_logic
+  //
+  // Collects the received bytes in a burst. Each completed
+  // byte is shifted in from the top, so the first byte ends
+  // up as the least significant byte.
+  //----------------------------------------------------------------
+  always @* begin : spi_rx_word_logic
+    spi_rx_word_new = {spi_rx_shift, spi_rx_word_reg[31 : 8]};
+  end
+
+
   //----------------------------------------------------------------
   // spi_master_ctrl
   //----------------------------------------------------------------
   always @* begin : spi_master_ctrl
-    spi_rx_data_nxt = 1'h0;
-    spi_tx_data_nxt = 1'h0;
-    spi_csk_new     = 1'h0;
-    spi_csk_we      = 1'h0;
-    spi_bit_ctr_rst = 1'h0;
-    spi_bit_ctr_inc = 1'h0;
-    spi_ready_new   = 1'h0;
-    spi_ready_we    = 1'h0;
-    spi_ctrl_new    = CTRL_IDLE;
-    spi_ctrl_we     = 1'h0;
+    spi_rx_data_nxt  = 1'h0;
+    spi_tx_data_nxt  = 1'h0;
+    spi_csk_new      = 1'h0;
+    spi_csk_we       = 1'h0;
+    spi_bit_ctr_rst  = 1'h0;
+    spi_bit_ctr_inc  = 1'h0;
+    spi_byte_ctr_rst = 1'h0;
+    spi_byte_ctr_inc = 1'h0;
+    spi_tx_data_ld   = 1'h0;
+    spi_rx_word_we   = 1'h0;
+    spi_burst_new    = 1'h0;
+    spi_burst_we     = 1'h0;
+    spi_ready_new    = 1'h0;
+    spi_ready_we     = 1'h0;
+    spi_ctrl_new     = CTRL_IDLE;
+    spi_ctrl_we      = 1'h0;
 
     case (spi_ctrl_reg)
       CTRL_IDLE: begin
-        if (spi_start) begin
-          spi_csk_new     = 1'h0;
-          spi_csk_we      = 1'h1;
-          spi_bit_ctr_rst = 1'h1;
-          spi_ready_new   = 1'h0;
-          spi_ready_we    = 1'h1;
-          spi_ctrl_new    = CTRL_POS_FLANK;
-          spi_ctrl_we     = 1'h1;
+        if (spi_start || spi_burst_start) begin
+          spi_csk_new      = 1'h0;
+          spi_csk_we       = 1'h1;
+          spi_bit_ctr_rst  = 1'h1;
+          spi_byte_ctr_rst = 1'h1;
+          spi_burst_new    = spi_burst_start;
+          spi_burst_we     = 1'h1;
+          spi_ready_new    = 1'h0;
+          spi_ready_we     = 1'h1;
+          spi_ctrl_new     = CTRL_POS_FLANK;
+          spi_ctrl_we      = 1'h1;
         end
       end
 
@@ -254,11 +427,22 @@ module tk1_spi_master (
 
       CTRL_NEXT: begin
         spi_rx_data_nxt = 1'h1;
-        if (spi_bit_ctr_reg == 3'h7) begin
-          spi_ready_new = 1'h1;
-          spi_ready_we  = 1'h1;
-          spi_ctrl_new  = CTRL_IDLE;
-          spi_ctrl_we   = 1'h1;
+        if ((spi_bit_ctr_reg == 3'h7) || (spi_dual_reg && (spi_bit_ctr_reg == 3'h3))) begin
+          spi_rx_word_we = spi_burst_reg;
+
+          if (spi_burst_reg && (spi_byte_ctr_reg < 2'h3)) begin
+            spi_byte_ctr_inc = 1'h1;
+            spi_bit_ctr_rst  = 1'h1;
+            spi_tx_data_ld   = 1'h1;
+            spi_ctrl_new     = CTRL_POS_FLANK;
+            spi_ctrl_we      = 1'h1;
+          end
+          else begin
+            spi_ready_new = 1'h1;
+            spi_ready_we  = 1'h1;
+            spi_ctrl_new  = CTRL_IDLE;
+            spi_ctrl_we   = 1'h1;
+          end
         end
         else begin
           spi_bit_ctr_inc = 1'h1;
@@ -51,6 +51,9 @@ module tb_tk1 ();
 
   localparam ADDR_RAM_ADDR_RAND = 8'h40;
   localparam ADDR_RAM_DATA_RAND = 8'h41;
+  localparam ADDR_RAM_FILL_STATE = 8'h42;
+  localparam ADDR_RAM_FILL_ACC = 8'h43;
+  localparam ADDR_RAM_FILL = 8'h44;
 
   localparam ADDR_CPU_MON_CTRL = 8'h60;
   localparam ADDR_CPU_MON_FIRST = 8'h61;
@@ -61,6 +64,10 @@ module tb_tk1 ();
   localparam ADDR_SPI_EN = 8'h80;
   localparam ADDR_SPI_XFER = 8'h81;
   localparam ADDR_SPI_DATA = 8'h82;
+  localparam ADDR_SPI_BURST = 8'h83;
+  localparam ADDR_SPI_DMA_DST = 8'h84;
+  localparam ADDR_SPI_DMA_LEN = 8'h85;
+  localparam ADDR_SPI_MODE = 8'h86;
 
   localparam APP_RAM_START = 32'h40000000;
 
@@ -91,6 +98,28 @@ module tb_tk1 ();
   wire [14 : 0] tb_ram_addr_rand;
   wire [31 : 0] tb_ram_data_rand;
 
+  wire [31 : 0] tb_ram_fill_data;
+  wire          tb_ram_fill_state_we;
+  wire          tb_ram_fill_acc_we;
+  wire          tb_ram_fill_start;
+  reg           tb_ram_fill_busy;
+
+  reg  [31 : 0] fill_start_ctr;
+  reg  [31 : 0] fill_last_state;
+  reg  [31 : 0] fill_last_acc;
+
+  wire          tb_spi_dma_ram_req;
+  wire [14 : 0] tb_spi_dma_ram_address;
+  wire [31 : 0] tb_spi_dma_ram_write_data;
+  wire          tb_spi_dma_ram_ack;
+
+  reg  [31 : 0] dma_write_ctr;
+  reg  [14 : 0] dma_last_address;
+  reg  [31 : 0] dma_last_data;
+  reg  [31 : 0] dma_order_errors;
+  reg           dma_ram_stall;
+  reg  [ 1 : 0] dma_stall_ctr;
+
   wire          tb_led_r;
   wire          tb_led_g;
   wire          tb_led_b;
@@ -105,6 +134,8 @@ module tb_tk1 ();
   wire          tb_spi_ss;
   wire          tb_spi_sck;
   wire          tb_spi_mosi;
+  wire          tb_spi_mosi_en;
+  wire          tb_spi_io0;
   wire          tb_spi_miso;
 
   reg           tb_cs;
@@ -119,6 +150,11 @@ module tb_tk1 ();
   //----------------------------------------------------------------
   // Inverted loopback of SPI data lines.
   assign tb_spi_miso = ~tb_spi_mosi;
+  assign tb_spi_io0  = 1'h0;
+
+  // The RAM is available to the SPI DMA, or only one cycle in four
+  // when dma_ram_stall is set, as when the CPU uses it.
+  assign tb_spi_dma_ram_ack = tb_spi_dma_ram_req & (!dma_ram_stall | (dma_stall_ctr == 2'h0));
 
 
   //----------------------------------------------------------------
@@ -140,6 +176,17 @@ module tb_tk1 ();
       .ram_addr_rand(tb_ram_addr_rand),
       .ram_data_rand(tb_ram_data_rand),
 
+      .ram_fill_data(tb_ram_fill_data),
+      .ram_fill_state_we(tb_ram_fill_state_we),
+      .ram_fill_acc_we(tb_ram_fill_acc_we),
+      .ram_fill_start(tb_ram_fill_start),
+      .ram_fill_busy(tb_ram_fill_busy),
+
+      .spi_dma_ram_req(tb_spi_dma_ram_req),
+      .spi_dma_ram_address(tb_spi_dma_ram_address),
+      .spi_dma_ram_write_data(tb_spi_dma_ram_write_data),
+      .spi_dma_ram_ack(tb_spi_dma_ram_ack),
+
       .led_r(tb_led_r),
       .led_g(tb_led_g),
       .led_b(tb_led_b),
@@ -154,6 +201,8 @@ module tb_tk1 ();
       .spi_ss  (tb_spi_ss),
       .spi_sck (tb_spi_sck),
       .spi_mosi(tb_spi_mosi),
+      .spi_mosi_en(tb_spi_mosi_en),
+      .spi_io0(tb_spi_io0),
       .spi_miso(tb_spi_miso),
 
       .cs(tb_cs),
@@ -191,6 +240,47 @@ module tb_tk1 ();
   end
 
 
+  //----------------------------------------------------------------
+  // dma_ram_monitor
+  //
+  // Record the RAM writes done by the SPI DMA, and count writes
+  // that don't go to the word after the previous one.
+  //----------------------------------------------------------------
+  always @(posedge tb_clk) begin : dma_ram_monitor
+    dma_stall_ctr <= dma_stall_ctr + 1'h1;
+
+    if (tb_spi_dma_ram_req && tb_spi_dma_ram_ack) begin
+      if ((dma_write_ctr != 0) && (tb_spi_dma_ram_address != dma_last_address + 1'h1)) begin
+        dma_order_errors <= dma_order_errors + 1;
+      end
+
+      dma_write_ctr    <= dma_write_ctr + 1;
+      dma_last_address <= tb_spi_dma_ram_address;
+      dma_last_data    <= tb_spi_dma_ram_write_data;
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // ram_fill_monitor
+  //
+  // Record the RAM fill seeds and starts.
+  //----------------------------------------------------------------
+  always @(posedge tb_clk) begin : ram_fill_monitor
+    if (tb_ram_fill_state_we) begin
+      fill_last_state <= tb_ram_fill_data;
+    end
+
+    if (tb_ram_fill_acc_we) begin
+      fill_last_acc <= tb_ram_fill_data;
+    end
+
+    if (tb_ram_fill_start) begin
+      fill_start_ctr <= fill_start_ctr + 1;
+    end
+  end
+
+
   //----------------------------------------------------------------
   // dump_dut_state()
   //
@@ -288,6 +378,18 @@ module tb_tk1 ();
 
       tb_syscall = 1'h0;
 
+      dma_write_ctr    = 32'h0;
+      dma_last_address = 15'h0;
+      dma_last_data    = 32'h0;
+      dma_order_errors = 32'h0;
+      dma_ram_stall    = 1'h0;
+      dma_stall_ctr    = 2'h0;
+
+      tb_ram_fill_busy = 1'h0;
+      fill_start_ctr   = 32'h0;
+      fill_last_state  = 32'h0;
+      fill_last_acc    = 32'h0;
+
       tb_cs           = 1'h0;
       tb_we           = 1'h0;
       tb_address      = 8'h0;
@@ -1033,11 +1135,29 @@ module tb_tk1 ();
       cpu_read_check_range_should_trap(32'hc4000400, 32'hc400040f);
       cpu_read_check_range_should_trap(32'hc4fffff0, 32'hc4ffffff);
 
-      // Unused      trap range: 0xc5000000-0xcfffffff
-      $display("--- test11: Unused");
-      cpu_read_check_range_should_trap(32'hc5000000, 32'hc500000f);
+      // BLAKE2S     trap range: 0xc5000400-0xc5ffffff
+      $display("--- test11: BLAKE2S");
+      cpu_read_check_range_should_not_trap(32'hc5000000, 32'hc50003ff);
+      cpu_read_check_range_should_trap(32'hc5000400, 32'hc500040f);
       cpu_read_check_range_should_trap(32'hc5fffff0, 32'hc5ffffff);
 
+      // SHA512      trap range: 0xc6000400-0xc6ffffff
+      $display("--- test11: SHA512");
+      cpu_read_check_range_should_not_trap(32'hc6000000, 32'hc60003ff);
+      cpu_read_check_range_should_trap(32'hc6000400, 32'hc600040f);
+      cpu_read_check_range_should_trap(32'hc6fffff0, 32'hc6ffffff);
+
+      // FE25519     trap range: 0xc7000400-0xc7ffffff
+      $display("--- test11: FE25519");
+      cpu_read_check_range_should_not_trap(32'hc7000000, 32'hc70003ff);
+      cpu_read_check_range_should_trap(32'hc7000400, 32'hc700040f);
+      cpu_read_check_range_should_trap(32'hc7fffff0, 32'hc7ffffff);
+
+      // Unused      trap range: 0xc8000000-0xcfffffff
+      $display("--- test11: Unused");
+      cpu_read_check_range_should_trap(32'hc8000000, 32'hc800000f);
+      cpu_read_check_range_should_trap(32'hcffffff0, 32'hcfffffff);
+
       // FW_RAM      trap range: 0xd0000800-0xd0ffffff
       $display("--- test11: FW_RAM");
       cpu_read_check_range_should_not_trap(32'hd0000000, 32'hd0000fff);
@@ -1163,6 +1283,174 @@ module tb_tk1 ();
   endtask  // test13
 
 
+  //----------------------------------------------------------------
+  // test14()
+  // SPI master burst and DMA using the inverting loopback.
+  //----------------------------------------------------------------
+  task test14;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      restore_mem_bus();
+      reset_dut();
+
+      $display("");
+      $display("--- test14: SPI burst and DMA started.");
+
+      write_word(ADDR_SPI_EN, 32'h1);
+      write_word(ADDR_SPI_BURST, 32'h12345678);
+
+      read_word(ADDR_SPI_XFER);
+      while (!tb_read_data) begin
+        read_word(ADDR_SPI_XFER);
+      end
+
+      #(2 * CLK_PERIOD);
+      read_check_word(ADDR_SPI_BURST, 32'hedcba987);
+
+      $display("--- test14: DMA three words to RAM offset 0x100.");
+      dma_write_ctr = 32'h0;
+      write_word(ADDR_SPI_DMA_DST, 32'h100);
+      write_word(ADDR_SPI_DMA_LEN, 32'h3);
+
+      read_word(ADDR_SPI_DMA_LEN);
+      while (tb_read_data) begin
+        read_word(ADDR_SPI_DMA_LEN);
+      end
+
+      #(2 * CLK_PERIOD);
+      check_equal(dma_write_ctr, 32'h3);
+      check_equal(dma_last_address, 15'h42);
+      check_equal(dma_last_data, 32'hffffffff);
+      read_check_word(ADDR_SPI_DMA_DST, 32'h10c);
+
+      $display("--- test14: DMA eight words to RAM offset 0x200 with the RAM busy.");
+      dma_write_ctr = 32'h0;
+      dma_ram_stall = 1'h1;
+      write_word(ADDR_SPI_DMA_DST, 32'h200);
+      write_word(ADDR_SPI_DMA_LEN, 32'h8);
+
+      read_word(ADDR_SPI_DMA_LEN);
+      while (tb_read_data) begin
+        read_word(ADDR_SPI_DMA_LEN);
+      end
+
+      #(2 * CLK_PERIOD);
+      dma_ram_stall = 1'h0;
+      check_equal(dma_write_ctr, 32'h8);
+      check_equal(dma_last_address, 15'h87);
+      check_equal(dma_order_errors, 32'h0);
+      read_check_word(ADDR_SPI_DMA_DST, 32'h220);
+
+      $display("--- test14: DMA stops in app mode.");
+      dma_write_ctr = 32'h0;
+      write_word(ADDR_SPI_DMA_LEN, 32'h3);
+      fetch_instruction(APP_RAM_START);
+      #(200 * CLK_PERIOD);
+      check_equal(dma_write_ctr, 32'h0);
+
+      write_word(ADDR_SPI_EN, 32'h0);
+
+      $display("--- test14: completed.");
+      $display("");
+    end
+  endtask  // test14
+
+
+  //----------------------------------------------------------------
+  // test15()
+  // SPI dual mode. With MOSI at zero the inverted loopback
+  // gives ones on MISO and IO0 is tied to zero, so a byte
+  // received in dual mode is 0xaa.
+  //----------------------------------------------------------------
+  task test15;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      restore_mem_bus();
+      reset_dut();
+
+      $display("");
+      $display("--- test15: SPI dual mode started.");
+
+      write_word(ADDR_SPI_EN, 32'h1);
+      write_word(ADDR_SPI_MODE, 32'h1);
+      read_check_word(ADDR_SPI_MODE, 32'h1);
+      check_equal(tb_spi_mosi_en, 1'h0);
+
+      write_word(ADDR_SPI_DATA, 32'h0);
+      write_word(ADDR_SPI_XFER, 32'h1);
+
+      read_word(ADDR_SPI_XFER);
+      while (!tb_read_data) begin
+        read_word(ADDR_SPI_XFER);
+      end
+
+      #(2 * CLK_PERIOD);
+      read_check_word(ADDR_SPI_DATA, 32'haa);
+
+      $display("--- test15: Dual mode is left when disabling the SPI-master.");
+      write_word(ADDR_SPI_EN, 32'h0);
+      read_check_word(ADDR_SPI_MODE, 32'h0);
+      check_equal(tb_spi_mosi_en, 1'h1);
+
+      $display("--- test15: completed.");
+      $display("");
+    end
+  endtask  // test15
+
+
+  //----------------------------------------------------------------
+  // test16()
+  // RAM fill control. The seeds can only be written and the
+  // fill started in fw mode. The busy bit from the RAM can
+  // always be read.
+  //----------------------------------------------------------------
+  task test16;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      restore_mem_bus();
+      tb_syscall = 0;
+      reset_dut();
+
+      $display("");
+      $display("--- test16: RAM fill control started.");
+
+      write_word(ADDR_RAM_FILL_STATE, 32'h13371337);
+      write_word(ADDR_RAM_FILL_ACC, 32'h47114711);
+      write_word(ADDR_RAM_FILL, 32'h1);
+      #(CLK_PERIOD);
+      check_equal(fill_last_state, 32'h13371337);
+      check_equal(fill_last_acc, 32'h47114711);
+      check_equal(fill_start_ctr, 32'h1);
+
+      read_check_word(ADDR_RAM_FILL, 32'h0);
+      tb_ram_fill_busy = 1'h1;
+      read_check_word(ADDR_RAM_FILL, 32'h1);
+      tb_ram_fill_busy = 1'h0;
+
+      $display("--- test16: Switch to app mode.");
+      fetch_instruction(APP_RAM_START);
+
+      write_word(ADDR_RAM_FILL_STATE, 32'hdeadbeef);
+      write_word(ADDR_RAM_FILL_ACC, 32'hf00ff00f);
+      write_word(ADDR_RAM_FILL, 32'h1);
+      #(CLK_PERIOD);
+      check_equal(fill_last_state, 32'h13371337);
+      check_equal(fill_last_acc, 32'h47114711);
+      check_equal(fill_start_ctr, 32'h1);
+
+      tb_ram_fill_busy = 1'h1;
+      read_check_word(ADDR_RAM_FILL, 32'h1);
+      tb_ram_fill_busy = 1'h0;
+
+      $display("--- test16: completed.");
+      $display("");
+    end
+  endtask  // test16
+
+
   //----------------------------------------------------------------
   // exit_with_error_code()
   //
@@ -1205,6 +1493,9 @@ module tb_tk1 ();
     test11();
     test12();
     test13();
+    test14();
+    test15();
+    test16();
 
     display_test_result();
     $display("");
@@ -43,6 +43,8 @@ module tb_tk1_spi_master ();
   wire          tb_spi_ss;
   wire          tb_spi_sck;
   wire          tb_spi_mosi;
+  wire          tb_spi_mosi_en;
+  wire          tb_spi_dio;
   wire          tb_spi_miso;
   reg           tb_spi_enable;
   reg           tb_spi_enable_vld;
@@ -50,6 +52,12 @@ module tb_tk1_spi_master ();
   reg  [ 7 : 0] tb_spi_tx_data;
   reg           tb_spi_tx_data_vld;
   wire [ 7 : 0] tb_spi_rx_data;
+  reg           tb_spi_burst_start;
+  reg  [31 : 0] tb_spi_tx_word;
+  wire [31 : 0] tb_spi_rx_word;
+  reg           tb_spi_dual;
+  reg           tb_spi_dual_vld;
+  wire          tb_spi_dual_mode;
   wire          tb_spi_ready;
 
   wire          mem_model_WPn;
@@ -65,6 +73,9 @@ module tb_tk1_spi_master ();
   //----------------------------------------------------------------
   assign mem_model_WPn = 1'h1;
 
+  // MOSI is released in dual mode, letting the memory drive DIO.
+  assign tb_spi_dio    = tb_spi_mosi_en ? tb_spi_mosi : 1'hz;
+
 
   //----------------------------------------------------------------
   // Device Under Test.
@@ -76,6 +87,8 @@ module tb_tk1_spi_master ();
       .spi_ss  (tb_spi_ss),
       .spi_sck (tb_spi_sck),
       .spi_mosi(tb_spi_mosi),
+      .spi_mosi_en(tb_spi_mosi_en),
+      .spi_io0(tb_spi_dio),
       .spi_miso(tb_spi_miso),
 
       .spi_enable(tb_spi_enable),
@@ -84,6 +97,12 @@ module tb_tk1_spi_master ();
       .spi_tx_data(tb_spi_tx_data),
       .spi_tx_data_vld(tb_spi_tx_data_vld),
       .spi_rx_data(tb_spi_rx_data),
+      .spi_burst_start(tb_spi_burst_start),
+      .spi_tx_word(tb_spi_tx_word),
+      .spi_rx_word(tb_spi_rx_word),
+      .spi_dual(tb_spi_dual),
+      .spi_dual_vld(tb_spi_dual_vld),
+      .spi_dual_mode(tb_spi_dual_mode),
       .spi_ready(tb_spi_ready)
   );
 
@@ -94,7 +113,7 @@ module tb_tk1_spi_master ();
   W25Q80DL spi_memory (
       .CSn(tb_spi_ss),
       .CLK(tb_spi_sck),
-      .DIO(tb_spi_mosi),
+      .DIO(tb_spi_dio),
       .DO(tb_spi_miso),
       .WPn(mem_model_WPn),
       .HOLDn(mem_model_HOLDn)
@@ -239,6 +258,10 @@ module tb_tk1_spi_master ();
       tb_spi_start       = 1'h0;
       tb_spi_tx_data     = 8'h0;
       tb_spi_tx_data_vld = 1'h0;
+      tb_spi_burst_start = 1'h0;
+      tb_spi_tx_word     = 32'h0;
+      tb_spi_dual        = 1'h0;
+      tb_spi_dual_vld    = 1'h0;
       tb_miso_mux_ctrl   = MISO_MOSI;
     end
   endtask  // init_sim
@@ -292,6 +315,22 @@ module tb_tk1_spi_master ();
   endtask  // disable_spi
 
 
+  //----------------------------------------------------------------
+  // enable_dual
+  //
+  // Put the SPI-master in dual mode.
+  //----------------------------------------------------------------
+  task enable_dual;
+    begin
+      tb_spi_dual     = 1'h1;
+      tb_spi_dual_vld = 1'h1;
+      #(CLK_PERIOD);
+      tb_spi_dual_vld = 1'h0;
+      #(CLK_PERIOD);
+    end
+  endtask  // enable_dual
+
+
   //----------------------------------------------------------------
   // xfer_byte
   //
@@ -334,6 +373,44 @@ module tb_tk1_spi_master ();
   endtask  // xfer_byte
 
 
+  //----------------------------------------------------------------
+  // xfer_word
+  //
+  // Wait until the SPI-master is ready, then send the four bytes
+  // in the input word, least significant byte first, in a burst
+  // and return the four received bytes in the same order.
+  //----------------------------------------------------------------
+  task xfer_word(input [31 : 0] to_mem, output [31 : 0] from_mem);
+    begin
+      if (verbose) begin
+        $display("xfer_word: Trying to send 0x%08x to mem", to_mem);
+      end
+
+      while (tb_spi_ready == 1'h0) begin
+        #(CLK_PERIOD);
+      end
+      #(CLK_PERIOD);
+
+      tb_spi_tx_word     = to_mem;
+      tb_spi_burst_start = 1'h1;
+      #(CLK_PERIOD);
+      tb_spi_burst_start = 1'h0;
+      #(CLK_PERIOD);
+
+      while (tb_spi_ready == 1'h0) begin
+        #(CLK_PERIOD);
+      end
+      #(CLK_PERIOD);
+
+      from_mem = tb_spi_rx_word;
+      #(CLK_PERIOD);
+      if (verbose) begin
+        $display("xfer_word: Received 0x%08x from mem", from_mem);
+      end
+    end
+  endtask  // xfer_word
+
+
   //----------------------------------------------------------------
   // read_mem_range()
   //
@@ -395,6 +472,57 @@ module tb_tk1_spi_master ();
     end
   endtask  // read_status
 
+  //----------------------------------------------------------------
+  // write_enable()
+  //
+  // Send the write enable command 0x06.
+  //----------------------------------------------------------------
+  task write_enable;
+    begin : write_enable
+      reg [7 : 0] dummy;
+      enable_spi();
+      #(2 * CLK_PERIOD);
+      xfer_byte(8'h06, dummy);
+      disable_spi();
+      #(2 * CLK_PERIOD);
+    end
+  endtask  // write_enable
+
+
+  //----------------------------------------------------------------
+  // wait_ready()
+  //
+  // Poll status register 1 until the memory is no longer busy.
+  //----------------------------------------------------------------
+  task wait_ready;
+    begin : wait_ready
+      reg [7 : 0] dummy;
+      reg [7 : 0] status;
+      status = 8'h01;
+      while (status[0]) begin
+        enable_spi();
+        #(2 * CLK_PERIOD);
+        xfer_byte(8'h05, dummy);
+        xfer_byte(8'h00, status);
+        disable_spi();
+        #(2 * CLK_PERIOD);
+      end
+    end
+  endtask  // wait_ready
+
+
+  //----------------------------------------------------------------
+  // pattern_byte()
+  //
+  // Byte i of the known pattern written by tc_burst_write_mem.
+  //----------------------------------------------------------------
+  function [7 : 0] pattern_byte(input integer i);
+    begin
+      pattern_byte = (i * 8'h3b) ^ 8'ha5;
+    end
+  endfunction  // pattern_byte
+
+
   //----------------------------------------------------------------
   // check_byte()
   //
@@ -681,6 +809,263 @@ module tb_tk1_spi_master ();
   endtask  // tc_read_mem
 
 
+  //----------------------------------------------------------------
+  // tc_burst_read_mem()
+  //
+  // Test case that reads out the first 16 bytes of the memory,
+  // first byte by byte and then using four byte bursts, with the
+  // command and address also sent as a burst. Checks that both
+  // give the same data and reports the number of cycles spent.
+  //----------------------------------------------------------------
+  task tc_burst_read_mem;
+    begin : tc_burst_read_mem
+      reg [ 7 : 0] bytes    [0 : 15];
+      reg [ 7 : 0] rx_byte;
+      reg [31 : 0] rx_word;
+      reg [31 : 0] start_cycle;
+      reg [31 : 0] byte_cycles;
+      reg [31 : 0] burst_cycles;
+      integer i;
+      tc_ctr  = tc_ctr + 1;
+      monitor = 0;
+      verbose = 0;
+
+      $display("");
+      $display("--- tc_burst_read_mem: Read out the first 16 bytes, bytewise and in bursts.");
+
+      #(2 * CLK_PERIOD);
+      enable_spi();
+      #(2 * CLK_PERIOD);
+
+      start_cycle = cycle_ctr;
+      xfer_byte(8'h03, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      for (i = 0; i < 16; i = i + 1) begin
+        xfer_byte(8'h00, bytes[i]);
+      end
+      byte_cycles = cycle_ctr - start_cycle;
+
+      disable_spi();
+      #(2 * CLK_PERIOD);
+      enable_spi();
+      #(2 * CLK_PERIOD);
+
+      // Read command 0x03 and address 0x000000 in one burst.
+      start_cycle = cycle_ctr;
+      xfer_word(32'h00000003, rx_word);
+      for (i = 0; i < 16; i = i + 4) begin
+        xfer_word(32'h00000000, rx_word);
+        check_byte(rx_word[7 : 0], bytes[i]);
+        check_byte(rx_word[15 : 8], bytes[i+1]);
+        check_byte(rx_word[23 : 16], bytes[i+2]);
+        check_byte(rx_word[31 : 24], bytes[i+3]);
+      end
+      burst_cycles = cycle_ctr - start_cycle;
+
+      disable_spi();
+      #(2 * CLK_PERIOD);
+
+      $display("--- tc_burst_read_mem: bytewise: %0d cycles, bursts: %0d cycles.", byte_cycles,
+               burst_cycles);
+
+      if (burst_cycles >= byte_cycles) begin
+        $display("--- tc_burst_read_mem: Error: Bursts not faster than bytewise.");
+        error_ctr = error_ctr + 1;
+      end
+      $display("--- tc_burst_read_mem: completed.");
+      $display("");
+    end
+  endtask  // tc_burst_read_mem
+
+
+  //----------------------------------------------------------------
+  // tc_dual_read_mem()
+  //
+  // Test case that reads out the first 16 bytes of the memory,
+  // first with the read command 0x03 and then with the Dual
+  // Output Fast Read command 0x3b. The eight dummy clocks are
+  // two bytes in dual mode. Checks that both give the same data
+  // and reports the number of cycles spent.
+  //----------------------------------------------------------------
+  task tc_dual_read_mem;
+    begin : tc_dual_read_mem
+      reg [ 7 : 0] bytes      [0 : 15];
+      reg [ 7 : 0] rx_byte;
+      reg [31 : 0] rx_word;
+      reg [31 : 0] start_cycle;
+      reg [31 : 0] single_cycles;
+      reg [31 : 0] dual_cycles;
+      integer i;
+      tc_ctr  = tc_ctr + 1;
+      monitor = 0;
+      verbose = 0;
+
+      $display("");
+      $display("--- tc_dual_read_mem: Read out the first 16 bytes, single and dual.");
+
+      #(2 * CLK_PERIOD);
+      enable_spi();
+      #(2 * CLK_PERIOD);
+
+      start_cycle = cycle_ctr;
+      xfer_word(32'h00000003, rx_word);
+      for (i = 0; i < 16; i = i + 4) begin
+        xfer_word(32'h00000000, rx_word);
+        bytes[i]   = rx_word[7 : 0];
+        bytes[i+1] = rx_word[15 : 8];
+        bytes[i+2] = rx_word[23 : 16];
+        bytes[i+3] = rx_word[31 : 24];
+      end
+      single_cycles = cycle_ctr - start_cycle;
+
+      disable_spi();
+      #(2 * CLK_PERIOD);
+      enable_spi();
+      #(2 * CLK_PERIOD);
+
+      // Dual output read command 0x3b and address 0x000000, then
+      // the dummy clocks and data in dual mode.
+      start_cycle = cycle_ctr;
+      xfer_word(32'h0000003b, rx_word);
+      enable_dual();
+      xfer_byte(8'h00, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      for (i = 0; i < 16; i = i + 4) begin
+        xfer_word(32'h00000000, rx_word);
+        check_byte(rx_word[7 : 0], bytes[i]);
+        check_byte(rx_word[15 : 8], bytes[i+1]);
+        check_byte(rx_word[23 : 16], bytes[i+2]);
+        check_byte(rx_word[31 : 24], bytes[i+3]);
+      end
+      dual_cycles = cycle_ctr - start_cycle;
+
+      disable_spi();
+      #(2 * CLK_PERIOD);
+
+      if (tb_spi_dual_mode) begin
+        $display("--- tc_dual_read_mem: Error: Still in dual mode after disable.");
+        error_ctr = error_ctr + 1;
+      end
+
+      $display("--- tc_dual_read_mem: single: %0d cycles, dual: %0d cycles.", single_cycles,
+               dual_cycles);
+
+      if (dual_cycles >= single_cycles) begin
+        $display("--- tc_dual_read_mem: Error: Dual not faster than single.");
+        error_ctr = error_ctr + 1;
+      end
+      $display("--- tc_dual_read_mem: completed.");
+      $display("");
+    end
+  endtask  // tc_dual_read_mem
+
+
+  //----------------------------------------------------------------
+  // tc_burst_write_mem()
+  //
+  // Test case that programs a known pattern of 16 bytes at address
+  // 0x000100, with the command, address and data sent in bursts.
+  // Then reads it back bytewise, in bursts and in dual mode and
+  // checks that all give the old content ANDed with the pattern,
+  // which is what programming does. Checks the byte order of the
+  // bursts in both directions against known data.
+  //----------------------------------------------------------------
+  task tc_burst_write_mem;
+    begin : tc_burst_write_mem
+      reg [ 7 : 0] expected [0 : 15];
+      reg [ 7 : 0] rx_byte;
+      reg [31 : 0] rx_word;
+      integer i;
+      tc_ctr  = tc_ctr + 1;
+      monitor = 0;
+      verbose = 0;
+
+      $display("");
+      $display("--- tc_burst_write_mem: Program 16 bytes in bursts and read them back.");
+
+      #(2 * CLK_PERIOD);
+      enable_spi();
+      #(2 * CLK_PERIOD);
+      xfer_byte(8'h03, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      xfer_byte(8'h01, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      for (i = 0; i < 16; i = i + 1) begin
+        xfer_byte(8'h00, rx_byte);
+        expected[i] = rx_byte & pattern_byte(i);
+      end
+      disable_spi();
+      #(2 * CLK_PERIOD);
+
+      write_enable();
+
+      // Page program command 0x02 and address 0x000100 in one
+      // burst, then the pattern.
+      enable_spi();
+      #(2 * CLK_PERIOD);
+      xfer_word(32'h00010002, rx_word);
+      for (i = 0; i < 16; i = i + 4) begin
+        xfer_word({pattern_byte(i + 3), pattern_byte(i + 2), pattern_byte(i + 1), pattern_byte(i)},
+                  rx_word);
+      end
+      disable_spi();
+      #(2 * CLK_PERIOD);
+
+      wait_ready();
+
+      $display("--- tc_burst_write_mem: Reading back bytewise.");
+      enable_spi();
+      #(2 * CLK_PERIOD);
+      xfer_byte(8'h03, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      xfer_byte(8'h01, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      for (i = 0; i < 16; i = i + 1) begin
+        xfer_byte(8'h00, rx_byte);
+        check_byte(rx_byte, expected[i]);
+      end
+      disable_spi();
+      #(2 * CLK_PERIOD);
+
+      $display("--- tc_burst_write_mem: Reading back in bursts.");
+      enable_spi();
+      #(2 * CLK_PERIOD);
+      xfer_word(32'h00010003, rx_word);
+      for (i = 0; i < 16; i = i + 4) begin
+        xfer_word(32'h00000000, rx_word);
+        check_byte(rx_word[7 : 0], expected[i]);
+        check_byte(rx_word[15 : 8], expected[i+1]);
+        check_byte(rx_word[23 : 16], expected[i+2]);
+        check_byte(rx_word[31 : 24], expected[i+3]);
+      end
+      disable_spi();
+      #(2 * CLK_PERIOD);
+
+      $display("--- tc_burst_write_mem: Reading back in dual mode.");
+      enable_spi();
+      #(2 * CLK_PERIOD);
+      xfer_word(32'h0001003b, rx_word);
+      enable_dual();
+      xfer_byte(8'h00, rx_byte);
+      xfer_byte(8'h00, rx_byte);
+      for (i = 0; i < 16; i = i + 4) begin
+        xfer_word(32'h00000000, rx_word);
+        check_byte(rx_word[7 : 0], expected[i]);
+        check_byte(rx_word[15 : 8], expected[i+1]);
+        check_byte(rx_word[23 : 16], expected[i+2]);
+        check_byte(rx_word[31 : 24], expected[i+3]);
+      end
+      disable_spi();
+      #(2 * CLK_PERIOD);
+
+      $display("--- tc_burst_write_mem: completed.");
+      $display("");
+    end
+  endtask  // tc_burst_write_mem
+
+
   //----------------------------------------------------------------
   // tc_rmr_mem()
   //
@@ -770,6 +1155,9 @@ module tb_tk1_spi_master ();
     //      tc_get_manufacturer_id();
     tc_get_unique_device_id();
     tc_read_mem();
+    tc_burst_read_mem();
+    tc_dual_read_mem();
+    tc_burst_write_mem();
     //      tc_rmr_mem();
 
     display_test_result();
@@ -36,12 +36,14 @@ module trng (
   //----------------------------------------------------------------
   // API
   localparam ADDR_STATUS = 8'h09;
+  localparam ADDR_ENTROPY_WORDS = 8'h0a;
   localparam ADDR_ENTROPY = 8'h20;
 
   // Total number of ROSCs will be 2 x NUM_ROSC.
   localparam SAMPLE_CYCLES = 16'h1000;
   localparam NUM_ROSC = 16;
   localparam SKIP_BITS = 32;
+  localparam FIFO_WORDS = 3'h4;
 
   localparam CTRL_SAMPLE1 = 0;
   localparam CTRL_SAMPLE2 = 1;
@@ -74,9 +76,13 @@ module trng (
   reg  [             1 : 0] sample2_new;
   reg                       sample2_we;
 
-  reg                       data_ready_reg;
-  reg                       data_ready_new;
-  reg                       data_ready_we;
+  reg  [            31 : 0] fifo_mem           [0 : (FIFO_WORDS - 1)];
+  reg  [             1 : 0] fifo_wr_ptr_reg;
+  reg  [             1 : 0] fifo_rd_ptr_reg;
+  reg  [             2 : 0] fifo_words_reg;
+  reg  [             2 : 0] fifo_words_new;
+  reg                       fifo_push;
+  reg                       fifo_pop;
 
   reg  [             1 : 0] trng_ctrl_reg;
   reg  [             1 : 0] trng_ctrl_new;
@@ -143,9 +149,11 @@ module trng (
       bit_ctr_reg    <= 8'h0;
       sample1_reg    <= 2'h0;
       sample2_reg    <= 2'h0;
-      entropy_reg    <= 32'h0;
-      data_ready_reg <= 1'h0;
-      trng_ctrl_reg  <= CTRL_SAMPLE1;
+      entropy_reg     <= 32'h0;
+      fifo_wr_ptr_reg <= 2'h0;
+      fifo_rd_ptr_reg <= 2'h0;
+      fifo_words_reg  <= 3'h0;
+      trng_ctrl_reg   <= CTRL_SAMPLE1;
     end
 
     else begin
@@ -167,10 +175,17 @@ module trng (
         entropy_reg <= entropy_new;
       end
 
-      if (data_ready_we) begin
-        data_ready_reg <= data_ready_new;
+      if (fifo_push) begin
+        fifo_mem[fifo_wr_ptr_reg] <= entropy_new;
+        fifo_wr_ptr_reg           <= fifo_wr_ptr_reg + 1'h1;
       end
 
+      if (fifo_pop) begin
+        fifo_rd_ptr_reg <= fifo_rd_ptr_reg + 1'h1;
+      end
+
+      fifo_words_reg <= fifo_words_new;
+
       if (trng_ctrl_we) begin
         trng_ctrl_reg <= trng_ctrl_new;
       end
@@ -181,10 +196,13 @@ module trng (
   //----------------------------------------------------------------
   // api
   //
-  // The interface command decoding logic.
+  // The interface command decoding logic. Reading the entropy
+  // pops the oldest word from the FIFO. If the FIFO is empty the
+  // word being collected is read, and collection starts over.
   //----------------------------------------------------------------
   always @* begin : api
     bit_ctr_rst   = 1'h0;
+    fifo_pop      = 1'h0;
     tmp_read_data = 32'h0;
     tmp_ready     = 1'h0;
 
@@ -193,12 +211,22 @@ module trng (
 
       if (!we) begin
         if (address == ADDR_STATUS) begin
-          tmp_read_data = {31'h0, data_ready_reg};
+          tmp_read_data = {31'h0, (fifo_words_reg != 3'h0)};
+        end
+
+        if (address == ADDR_ENTROPY_WORDS) begin
+          tmp_read_data = {29'h0, fifo_words_reg};
         end
 
         if (address == ADDR_ENTROPY) begin
-          tmp_read_data = entropy_reg;
-          bit_ctr_rst   = 1'h1;
+          if (fifo_words_reg != 3'h0) begin
+            tmp_read_data = fifo_mem[fifo_rd_ptr_reg];
+            fifo_pop      = 1'h1;
+          end
+          else begin
+            tmp_read_data = entropy_reg;
+            bit_ctr_rst   = 1'h1;
+          end
         end
       end
     end
@@ -207,27 +235,49 @@ module trng (
 
   //----------------------------------------------------------------
   // bit_ctr_logic
+  //
+  // When enough new bits have been collected, the entropy word is
+  // pushed to the FIFO and collection of the next word starts. If
+  // the FIFO is full, collection goes on and the latest word is
+  // pushed as soon as there is room.
   //----------------------------------------------------------------
   always @* begin : bit_ctr_logic
-    bit_ctr_new    = 8'h0;
-    bit_ctr_we     = 1'h0;
-    data_ready_new = 1'h0;
-    data_ready_we  = 1'h0;
+    bit_ctr_new = 8'h0;
+    bit_ctr_we  = 1'h0;
+    fifo_push   = 1'h0;
 
     if (bit_ctr_rst) begin
-      bit_ctr_new    = 8'h0;
-      bit_ctr_we     = 1'h1;
-      data_ready_new = 1'h0;
-      data_ready_we  = 1'h1;
+      bit_ctr_new = 8'h0;
+      bit_ctr_we  = 1'h1;
     end
     else if (bit_ctr_inc) begin
-      bit_ctr_new = bit_ctr_reg + 1'h1;
-      bit_ctr_we  = 1'h1;
-
       if (bit_ctr_reg == SKIP_BITS) begin
-        data_ready_new = 1'h1;
-        data_ready_we  = 1'h1;
+        if (fifo_words_reg != FIFO_WORDS) begin
+          fifo_push   = 1'h1;
+          bit_ctr_new = 8'h0;
+          bit_ctr_we  = 1'h1;
+        end
       end
+      else begin
+        bit_ctr_new = bit_ctr_reg + 1'h1;
+        bit_ctr_we  = 1'h1;
+      end
+    end
+  end
+
+
+  //----------------------------------------------------------------
+  // fifo_words_logic
+  //----------------------------------------------------------------
+  always @* begin : fifo_words_logic
+    fifo_words_new = fifo_words_reg;
+
+    if (fifo_push && !fifo_pop) begin
+      fifo_words_new = fifo_words_reg + 1'h1;
+    end
+
+    if (fifo_pop && !fifo_push) begin
+      fifo_words_new = fifo_words_reg - 1'h1;
     end
   end
 
@@ -26,8 +26,16 @@ module tb_trng ();
   // API
   localparam ADDR_STATUS = 8'h09;
   localparam STATUS_READY_BIT = 0;
+  localparam ADDR_ENTROPY_WORDS = 8'h0a;
   localparam ADDR_ENTROPY = 8'h20;
 
+  localparam FIFO_WORDS = 4;
+  localparam SKIP_BITS = 32;
+
+  // Lower bound of the cycles to collect one entropy word, two
+  // samples of at least 4096 cycles for each of the 33 bits.
+  localparam WORD_CYCLES = 33 * 2 * 4096;
+
 
   //----------------------------------------------------------------
   // Register and Wire declarations.
@@ -46,6 +54,12 @@ module tb_trng ();
   wire [31 : 0] tb_read_data;
   wire          tb_ready;
 
+  reg  [31 : 0] words;
+  time          start_time;
+
+  reg  [31 : 0] pushed     [0 : 3];
+  reg  [ 1 : 0] push_ctr;
+
 
   //----------------------------------------------------------------
   // Device Under Test.
@@ -74,6 +88,19 @@ module tb_trng ();
   end  // clk_gen
 
 
+  //----------------------------------------------------------------
+  // push_monitor
+  //
+  // Record the words pushed to the FIFO, in order.
+  //----------------------------------------------------------------
+  always @(posedge tb_clk) begin : push_monitor
+    if (dut.fifo_push) begin
+      pushed[push_ctr] <= dut.entropy_new;
+      push_ctr         <= push_ctr + 1'h1;
+    end
+  end  // push_monitor
+
+
   //----------------------------------------------------------------
   // sys_monitor()
   //
@@ -108,6 +135,8 @@ module tb_trng ();
       $display("cycle_ctr_done: 0x%1x, cycle_ctr_rst: 0x%1x, cycle_ctr: 0x%04x",
                dut.cycle_ctr_done, dut.cycle_ctr_rst, dut.cycle_ctr_reg);
       $display("bit_ctr: 0x%02x", dut.bit_ctr_reg);
+      $display("fifo_words: 0x%1x, fifo_wr_ptr: 0x%1x, fifo_rd_ptr: 0x%1x", dut.fifo_words_reg,
+               dut.fifo_wr_ptr_reg, dut.fifo_rd_ptr_reg);
       $display("");
       $display("");
     end
@@ -205,6 +234,75 @@ module tb_trng ();
   endtask  // read_word
 
 
+  //----------------------------------------------------------------
+  // read_words()
+  //
+  // Read the number of entropy words in the FIFO into the global
+  // variable words.
+  //----------------------------------------------------------------
+  task read_words;
+    begin
+      tb_address = ADDR_ENTROPY_WORDS;
+      tb_cs      = 1'h1;
+
+      #(CLK_HALF_PERIOD);
+      words = tb_read_data;
+
+      #(CLK_HALF_PERIOD);
+      tb_cs = 1'h0;
+    end
+  endtask  // read_words
+
+
+  //----------------------------------------------------------------
+  // check_words()
+  //
+  // Check the number of entropy words in the FIFO.
+  //----------------------------------------------------------------
+  task check_words(input [31 : 0] expected);
+    begin
+      read_words();
+      if (words != expected) begin
+        $display("--- Error: Got %0d entropy words, expected %0d.", words, expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_words
+
+
+  //----------------------------------------------------------------
+  // wait_words()
+  //
+  // Wait until there are at least the given number of entropy
+  // words in the FIFO.
+  //----------------------------------------------------------------
+  task wait_words(input [31 : 0] expected);
+    begin
+      read_words();
+      while (words < expected) begin
+        #(CLK_PERIOD);
+        read_words();
+      end
+    end
+  endtask  // wait_words
+
+
+  //----------------------------------------------------------------
+  // read_entropy()
+  //
+  // Read an entropy word. The word itself isn't checked since
+  // the oscillators don't oscillate in simulation.
+  //----------------------------------------------------------------
+  task read_entropy;
+    begin
+      tb_address = ADDR_ENTROPY;
+      tb_cs      = 1'h1;
+      #(CLK_PERIOD);
+      tb_cs = 1'h0;
+    end
+  endtask  // read_entropy
+
+
   //----------------------------------------------------------------
   // test1()
   //----------------------------------------------------------------
@@ -221,6 +319,207 @@ module tb_trng ();
     end
   endtask  // test1
 
+
+  //----------------------------------------------------------------
+  // test2()
+  // The first entropy word is pushed to the FIFO after all bits
+  // of it have been collected.
+  //----------------------------------------------------------------
+  task test2;
+    begin
+      tc_ctr = tc_ctr + 1;
+      tb_monitor = 0;
+
+      $display("");
+      $display("--- test2: started.");
+      reset_dut();
+      start_time = $time;
+
+      wait_words(1);
+      $display("--- test2: First word after %0d cycles.", ($time - start_time) / CLK_PERIOD);
+
+      if ((($time - start_time) / CLK_PERIOD) < WORD_CYCLES) begin
+        $display("--- Error: Word pushed before %0d cycles.", WORD_CYCLES);
+        error_ctr = error_ctr + 1;
+      end
+
+      read_word(ADDR_STATUS, 32'h1);
+      $display("--- test2: completed.");
+      $display("");
+    end
+  endtask  // test2
+
+
+  //----------------------------------------------------------------
+  // test3()
+  // The FIFO fills up to its size and stays full. Reading pops
+  // one word at a time.
+  //----------------------------------------------------------------
+  task test3;
+    begin : test3
+      integer i;
+
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test3: started.");
+
+      wait_words(FIFO_WORDS);
+      $display("--- test3: FIFO full after %0d cycles.", ($time - start_time) / CLK_PERIOD);
+      #(2 * WORD_CYCLES * CLK_PERIOD);
+      check_words(FIFO_WORDS);
+
+      // Pop right after a bit has been collected, so no word is
+      // pushed while popping.
+      while (!dut.bit_ctr_inc) begin
+        #(CLK_PERIOD);
+      end
+      #(CLK_PERIOD);
+
+      for (i = FIFO_WORDS - 1; i >= 0; i = i - 1) begin
+        read_entropy();
+        check_words(i);
+      end
+
+      read_word(ADDR_STATUS, 32'h0);
+      $display("--- test3: completed.");
+      $display("");
+    end
+  endtask  // test3
+
+
+  //----------------------------------------------------------------
+  // test4()
+  // Reading with an empty FIFO gives the word being collected and
+  // starts the collection over, so the next word still needs all
+  // bits to be collected.
+  //----------------------------------------------------------------
+  task test4;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test4: started.");
+      reset_dut();
+
+      #((WORD_CYCLES / 2) * CLK_PERIOD);
+      check_words(0);
+      read_entropy();
+      start_time = $time;
+
+      if (dut.bit_ctr_reg != 0) begin
+        $display("--- Error: Bit counter not reset by read.");
+        error_ctr = error_ctr + 1;
+      end
+
+      wait_words(1);
+      $display("--- test4: Next word after %0d cycles.", ($time - start_time) / CLK_PERIOD);
+      if ((($time - start_time) / CLK_PERIOD) < (WORD_CYCLES - 2 * 2 * 4096)) begin
+        $display("--- Error: Word pushed after only %0d cycles.",
+                 ($time - start_time) / CLK_PERIOD);
+        error_ctr = error_ctr + 1;
+      end
+
+      $display("--- test4: completed.");
+      $display("");
+    end
+  endtask  // test4
+
+
+  //----------------------------------------------------------------
+  // test5()
+  // Reading in the same cycle as a word is pushed pops the oldest
+  // word and keeps the new one, so the number of words stays the
+  // same.
+  //----------------------------------------------------------------
+  task test5;
+    begin : test5
+      reg [31 : 0] oldest;
+
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test5: started.");
+      reset_dut();
+
+      wait_words(2);
+
+      // Wait for the cycle where the next word is pushed.
+      while (!(dut.bit_ctr_inc && (dut.bit_ctr_reg == SKIP_BITS))) begin
+        #(CLK_PERIOD);
+      end
+
+      oldest = dut.fifo_mem[dut.fifo_rd_ptr_reg];
+      tb_address = ADDR_ENTROPY;
+      tb_cs      = 1'h1;
+      #(CLK_HALF_PERIOD);
+
+      if (!dut.fifo_push || !dut.fifo_pop) begin
+        $display("--- Error: Expected a push and a pop in the same cycle.");
+        error_ctr = error_ctr + 1;
+      end
+
+      if (tb_read_data !== oldest) begin
+        $display("--- Error: Got 0x%08x, expected the oldest word 0x%08x.", tb_read_data, oldest);
+        error_ctr = error_ctr + 1;
+      end
+
+      #(CLK_HALF_PERIOD);
+      tb_cs = 1'h0;
+
+      check_words(2);
+      if (dut.bit_ctr_reg != 0) begin
+        $display("--- Error: Collection of the next word not started over.");
+        error_ctr = error_ctr + 1;
+      end
+
+      $display("--- test5: completed.");
+      $display("");
+    end
+  endtask  // test5
+
+
+  //----------------------------------------------------------------
+  // test6()
+  // The words are read out in the order they were pushed, and a
+  // full FIFO doesn't overwrite any of them.
+  //----------------------------------------------------------------
+  task test6;
+    begin : test6
+      integer i;
+
+      tc_ctr = tc_ctr + 1;
+
+      $display("");
+      $display("--- test6: started.");
+      reset_dut();
+      push_ctr = 2'h0;
+
+      wait_words(FIFO_WORDS);
+      #(2 * WORD_CYCLES * CLK_PERIOD);
+      check_words(FIFO_WORDS);
+
+      // Pop right after a bit has been collected, so no word is
+      // pushed while popping.
+      while (!dut.bit_ctr_inc) begin
+        #(CLK_PERIOD);
+      end
+      #(CLK_PERIOD);
+
+      for (i = 0; i < FIFO_WORDS; i = i + 1) begin
+        read_word(ADDR_ENTROPY, pushed[i]);
+      end
+
+      if (push_ctr != 2'h0) begin
+        $display("--- Error: %0d words pushed to a full FIFO.", push_ctr);
+        error_ctr = error_ctr + 1;
+      end
+
+      $display("--- test6: completed.");
+      $display("");
+    end
+  endtask  // test6
+
   //----------------------------------------------------------------
   // exit_with_error_code()
   //
@@ -250,6 +549,11 @@ module tb_trng ();
     init_sim();
     reset_dut();
     test1();
+    test2();
+    test3();
+    test4();
+    test5();
+    test6();
 
     display_test_result();
     $display("");
@@ -5,8 +5,8 @@
 // Top level wrapper for the uart core.
 //
 // A simple universal asynchronous receiver/transmitter (UART)
-// interface. The interface contains 16 byte wide transmit and
-// receivea buffers and can handle start and stop bits. But in
+// interface. The interface contains 512 byte wide transmit and
+// receive buffers and can handle start and stop bits. But in
 // general is rather simple. The primary purpose is as host
 // interface for the coretest design. The core also has a
 // loopback mode to allow testing of a serial link.
@@ -72,12 +72,20 @@ module uart (
   //----------------------------------------------------------------
   // Internal constant and parameter definitions.
   //----------------------------------------------------------------
+  localparam ADDR_BIT_RATE = 8'h10;
+
   localparam ADDR_RX_STATUS = 8'h20;
   localparam ADDR_RX_DATA = 8'h21;
   localparam ADDR_RX_BYTES = 8'h22;
+  localparam ADDR_RX_WORD = 8'h23;
 
   localparam ADDR_TX_STATUS = 8'h40;
   localparam ADDR_TX_DATA = 8'h41;
+  localparam ADDR_TX_FREE = 8'h42;
+  localparam ADDR_TX_BYTES = 8'h43;
+
+  // One entry of the FIFO is always kept free.
+  localparam FIFO_SIZE = 9'h1ff;
 
   // The default bit rate is based on target clock frequency
   // divided by the bit rate times in order to hit the
@@ -85,6 +93,8 @@ module uart (
   // Clock: 24 MHz, 500 kbps
   // Divisor = 24E6 / 500E3 = 48
   // This also satisfies 1E6 % bps == 0 for the CH552 MCU used for USB-serial
+  // Note that a bit is bit_rate + 1 cycles long in uart_core, so
+  // the actual bit rate is slightly lower.
   localparam DEFAULT_BIT_RATE = 16'd48;
   localparam DEFAULT_DATA_BITS = 4'h8;
   localparam DEFAULT_STOP_BITS = 2'h1;
@@ -93,6 +103,17 @@ module uart (
   //----------------------------------------------------------------
   // Registers including update variables and write enable.
   //----------------------------------------------------------------
+  reg  [23 : 0] rx_word_reg;
+  reg  [23 : 0] rx_word_new;
+  reg           rx_word_we;
+
+  reg  [ 1 : 0] rx_word_ctr_reg;
+  reg  [ 1 : 0] rx_word_ctr_new;
+  reg           rx_word_ctr_we;
+
+  reg  [15 : 0] bit_rate_reg;
+  reg           bit_rate_we;
+
 
   //----------------------------------------------------------------
   // Wires.
@@ -102,9 +123,17 @@ module uart (
   wire          core_rxd_ack;
 
   reg           core_txd_syn;
-  reg  [ 7 : 0] core_txd_data;
+  wire [ 7 : 0] core_txd_data;
   wire          core_txd_ready;
 
+  reg           tx_fifo_in_syn;
+  /* verilator lint_off UNUSED */
+  wire          tx_fifo_in_ack;
+  /* verilator lint_on UNUSED */
+  wire          tx_fifo_out_syn;
+  reg           tx_fifo_out_ack;
+  wire [ 8 : 0] tx_fifo_bytes;
+
   wire          fifo_out_syn;
   wire [ 7 : 0] fifo_out_data;
   reg           fifo_out_ack;
@@ -115,6 +144,8 @@ module uart (
 
   reg  [ 1 : 0] ch552_cts_reg;
 
+  reg  [ 7 : 0] rx_byte;
+
   //----------------------------------------------------------------
   // Concurrent connectivity for ports etc.
   //----------------------------------------------------------------
@@ -130,7 +161,7 @@ module uart (
       .reset_n(reset_n),
 
       // Configuration parameters
-      .bit_rate (DEFAULT_BIT_RATE),
+      .bit_rate (bit_rate_reg),
       .data_bits(DEFAULT_DATA_BITS),
       .stop_bits(DEFAULT_STOP_BITS),
 
@@ -167,43 +198,110 @@ module uart (
       .fpga_cts(fpga_cts)
   );
 
+
+  /* verilator lint_off PINCONNECTEMPTY */
+  uart_fifo tx_fifo (
+      .clk(clk),
+      .reset_n(reset_n),
+
+      .in_syn (tx_fifo_in_syn),
+      .in_data(write_data[7 : 0]),
+      .in_ack (tx_fifo_in_ack),
+
+      .fifo_bytes(tx_fifo_bytes),
+
+      .out_syn (tx_fifo_out_syn),
+      .out_data(core_txd_data),
+      .out_ack (tx_fifo_out_ack),
+
+      .fpga_cts()
+  );
+  /* verilator lint_on PINCONNECTEMPTY */
+
   //----------------------------------------------------------------
   // reg_update
   //----------------------------------------------------------------
   always @(posedge clk) begin : reg_update
     if (!reset_n) begin
-      ch552_cts_reg <= 2'h0;
+      ch552_cts_reg   <= 2'h0;
+      rx_word_reg     <= 24'h0;
+      rx_word_ctr_reg <= 2'h0;
+      bit_rate_reg    <= DEFAULT_BIT_RATE;
     end
     else begin
       ch552_cts_reg[0] <= ch552_cts;
       ch552_cts_reg[1] <= ch552_cts_reg[0];
+
+      if (rx_word_we) begin
+        rx_word_reg <= rx_word_new;
+      end
+
+      if (rx_word_ctr_we) begin
+        rx_word_ctr_reg <= rx_word_ctr_new;
+      end
+
+      if (bit_rate_we) begin
+        bit_rate_reg <= write_data[15 : 0];
+      end
     end
   end  // reg_update
 
+  //----------------------------------------------------------------
+  // tx_logic
+  //
+  // Moves bytes from the transmit FIFO to the transmitter as long
+  // as the CH552 is clear to send.
+  //----------------------------------------------------------------
+  always @* begin : tx_logic
+    core_txd_syn    = 1'h0;
+    tx_fifo_out_ack = 1'h0;
+
+    if (tx_fifo_out_syn && core_txd_ready && !ch552_cts_reg[1]) begin
+      core_txd_syn    = 1'h1;
+      tx_fifo_out_ack = 1'h1;
+    end
+  end  // tx_logic
+
   //----------------------------------------------------------------
   // api
   //
   // The core API that allows an internal host to control the
   // core functionality.
+  //
+  // Reading ADDR_RX_WORD pops four bytes from the FIFO, one per
+  // cycle, and returns them with the first byte as the least
+  // significant byte. Ready is held low until the fourth byte.
+  // If the FIFO runs empty, the remaining bytes read as zero.
+  //
+  // Bytes written to ADDR_TX_DATA are queued in the transmit FIFO.
+  // A byte written when the FIFO is full is dropped. ADDR_TX_BYTES
+  // also counts the byte being transmitted.
   //----------------------------------------------------------------
   always @* begin : api
     // Default assignments.
-    core_txd_syn  = 1'h0;
-    fifo_out_ack  = 1'h0;
-    tmp_read_data = 32'h0;
-    tmp_ready     = 1'h0;
-
-    core_txd_data = write_data[7 : 0];
+    tx_fifo_in_syn  = 1'h0;
+    bit_rate_we     = 1'h0;
+    fifo_out_ack    = 1'h0;
+    tmp_read_data   = 32'h0;
+    tmp_ready       = 1'h0;
+    rx_word_we      = 1'h0;
+    rx_word_ctr_new = rx_word_ctr_reg + 1'h1;
+    rx_word_ctr_we  = 1'h0;
+
+    rx_byte         = fifo_out_data & {8{fifo_out_syn}};
+    rx_word_new     = {rx_byte, rx_word_reg[23 : 8]};
 
     if (cs) begin
       tmp_ready = 1'h1;
 
       if (we) begin
         case (address)
+          ADDR_BIT_RATE: begin
+            bit_rate_we = 1'h1;
+          end
+
           ADDR_TX_DATA: begin
-            if (core_txd_ready) begin
-              core_txd_syn = 1'h1;
-            end
+            tx_fifo_in_syn = 1'h1;
           end
 
           default: begin
@@ -213,6 +311,10 @@ module uart (
 
       else begin
         case (address)
+          ADDR_BIT_RATE: begin
+            tmp_read_data = {16'h0, bit_rate_reg};
+          end
+
           ADDR_RX_STATUS: begin
             tmp_read_data = {31'h0, fifo_out_syn};
           end
@@ -226,8 +328,29 @@ module uart (
             tmp_read_data = {23'h0, fifo_bytes};
           end
 
+          ADDR_RX_WORD: begin
+            fifo_out_ack   = fifo_out_syn;
+            rx_word_ctr_we = 1'h1;
+
+            if (rx_word_ctr_reg == 2'h3) begin
+              tmp_read_data = {rx_byte, rx_word_reg};
+            end
+            else begin
+              tmp_ready  = 1'h0;
+              rx_word_we = 1'h1;
+            end
+          end
+
           ADDR_TX_STATUS: begin
-            tmp_read_data = {31'h0, core_txd_ready & !ch552_cts_reg[1]};
+            tmp_read_data = {31'h0, tx_fifo_bytes != FIFO_SIZE};
+          end
+
+          ADDR_TX_FREE: begin
+            tmp_read_data = {23'h0, FIFO_SIZE - tx_fifo_bytes};
+          end
+
+          ADDR_TX_BYTES: begin
+            tmp_read_data = {22'h0, {1'h0, tx_fifo_bytes} + {9'h0, !core_txd_ready}};
           end
 
           default: begin
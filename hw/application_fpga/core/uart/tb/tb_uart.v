@@ -48,6 +48,15 @@ module tb_uart ();
   parameter CLK_HALF_PERIOD = 1;
   parameter CLK_PERIOD = CLK_HALF_PERIOD * 2;
 
+  localparam ADDR_BIT_RATE = 8'h10;
+  localparam ADDR_RX_DATA = 8'h21;
+  localparam ADDR_RX_BYTES = 8'h22;
+  localparam ADDR_RX_WORD = 8'h23;
+  localparam ADDR_TX_STATUS = 8'h40;
+  localparam ADDR_TX_DATA = 8'h41;
+  localparam ADDR_TX_FREE = 8'h42;
+  localparam ADDR_TX_BYTES = 8'h43;
+
 
   //----------------------------------------------------------------
   // Register and Wire declarations.
@@ -60,6 +69,8 @@ module tb_uart ();
   reg           tb_reset_n;
   reg           tb_rxd;
   wire          tb_txd;
+  reg           tb_ch552_cts;
+  wire          tb_fpga_cts;
   reg           tb_cs;
   reg           tb_we;
   reg  [ 7 : 0] tb_address;
@@ -80,6 +91,9 @@ module tb_uart ();
       .rxd(tb_rxd),
       .txd(tb_txd),
 
+      .ch552_cts(tb_ch552_cts),
+      .fpga_cts (tb_fpga_cts),
+
       // API interface.
       .cs(tb_cs),
       .we(tb_we),
@@ -226,6 +240,7 @@ module tb_uart ();
       tb_clk        = 0;
       tb_reset_n    = 1;
       tb_rxd        = 1;
+      tb_ch552_cts  = 0;
       tb_cs         = 0;
       tb_we         = 0;
       tb_address    = 8'h0;
@@ -391,6 +406,368 @@ module tb_uart ();
   endtask
 
 
+  //----------------------------------------------------------------
+  // read_word()
+  //
+  // Read a word from the given address in the dut, waiting for
+  // ready like the CPU does. The chip select is held until the
+  // clock edge where ready is seen.
+  //----------------------------------------------------------------
+  task read_word(input [7 : 0] address, output [31 : 0] data);
+    begin
+      @(negedge tb_clk);
+      tb_address = address;
+      tb_we      = 0;
+      tb_cs      = 1;
+
+      @(posedge tb_clk);
+      while (!tb_ready) begin
+        @(posedge tb_clk);
+      end
+      data = tb_read_data;
+
+      @(negedge tb_clk);
+      tb_cs = 0;
+    end
+  endtask  // read_word
+
+
+  //----------------------------------------------------------------
+  // check_word()
+  //----------------------------------------------------------------
+  task check_word(input [31 : 0] data, input [31 : 0] expected);
+    begin
+      if (data == expected) begin
+        $display("*** Correct data: 0x%08x.", data);
+      end
+      else begin
+        $display("*** Incorrect data: 0x%08x. Expected: 0x%08x.", data, expected);
+        error_ctr = error_ctr + 1;
+      end
+    end
+  endtask  // check_word
+
+
+  //----------------------------------------------------------------
+  // test_rx_word
+  //
+  // Receive five bytes, read four of them with one read from
+  // ADDR_RX_WORD and the last one from ADDR_RX_DATA.
+  //----------------------------------------------------------------
+  task test_rx_word;
+    reg [31 : 0] data;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("*** Reading received bytes as a word.");
+      reset_dut();
+
+      transmit_byte(8'h11, 0);
+      transmit_byte(8'h22, 0);
+      transmit_byte(8'h33, 0);
+      transmit_byte(8'h44, 0);
+      transmit_byte(8'h55, 0);
+      #(CLK_PERIOD * dut.DEFAULT_BIT_RATE);
+
+      read_word(ADDR_RX_BYTES, data);
+      check_word(data, 32'h5);
+
+      read_word(ADDR_RX_WORD, data);
+      check_word(data, 32'h44332211);
+
+      read_word(ADDR_RX_BYTES, data);
+      check_word(data, 32'h1);
+
+      read_word(ADDR_RX_DATA, data);
+      check_word(data, 32'h55);
+
+      read_word(ADDR_RX_BYTES, data);
+      check_word(data, 32'h0);
+    end
+  endtask  // test_rx_word
+
+
+  //----------------------------------------------------------------
+  // write_word()
+  //
+  // Write a word to the given address in the dut.
+  //----------------------------------------------------------------
+  task write_word(input [7 : 0] address, input [31 : 0] data);
+    begin
+      @(negedge tb_clk);
+      tb_address    = address;
+      tb_write_data = data;
+      tb_we         = 1;
+      tb_cs         = 1;
+
+      @(negedge tb_clk);
+      tb_cs = 0;
+      tb_we = 0;
+
+      // The CPU can not write on consecutive cycles.
+      @(negedge tb_clk);
+    end
+  endtask  // write_word
+
+
+  //----------------------------------------------------------------
+  // test_tx_fifo
+  //
+  // Queue three bytes while the CH552 is not clear to send, check
+  // the fill level and free space, then let them be transmitted
+  // and check that the FIFO drains.
+  //----------------------------------------------------------------
+  task test_tx_fifo;
+    reg [31 : 0] data;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("*** Queueing bytes in the transmit FIFO.");
+      reset_dut();
+
+      tb_ch552_cts = 1;
+      #(4 * CLK_PERIOD);
+
+      write_word(ADDR_TX_DATA, 32'ha1);
+      write_word(ADDR_TX_DATA, 32'hb2);
+      write_word(ADDR_TX_DATA, 32'hc3);
+
+      read_word(ADDR_TX_BYTES, data);
+      check_word(data, 32'h3);
+
+      read_word(ADDR_TX_FREE, data);
+      check_word(data, 32'h1fc);
+
+      read_word(ADDR_TX_STATUS, data);
+      check_word(data, 32'h1);
+
+      tb_ch552_cts = 0;
+      #(CLK_PERIOD * dut.DEFAULT_BIT_RATE * 10 * 4);
+
+      read_word(ADDR_TX_BYTES, data);
+      check_word(data, 32'h0);
+
+      read_word(ADDR_TX_FREE, data);
+      check_word(data, 32'h1ff);
+    end
+  endtask  // test_tx_fifo
+
+
+  //----------------------------------------------------------------
+  // test_tx_fifo_full
+  //
+  // Fill the transmit FIFO while the CH552 is not clear to send and
+  // check that it reports being full and drops a byte written then.
+  // Then let it drain and check that all 511 bytes are transmitted
+  // in order.
+  //----------------------------------------------------------------
+  task test_tx_fifo_full;
+    reg [31 : 0] data;
+    reg [ 7 : 0] rx_data;
+    reg          stop_ok;
+    integer      bit_time;
+    integer      byte_errors;
+    integer      i;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("*** Filling the transmit FIFO.");
+      reset_dut();
+
+      tb_ch552_cts = 1;
+      #(4 * CLK_PERIOD);
+
+      for (i = 0; i < 511; i = i + 1) begin
+        write_word(ADDR_TX_DATA, (i * 37) ^ 8'h69);
+      end
+
+      read_word(ADDR_TX_FREE, data);
+      check_word(data, 32'h0);
+
+      read_word(ADDR_TX_STATUS, data);
+      check_word(data, 32'h0);
+
+      write_word(ADDR_TX_DATA, 32'hee);
+
+      read_word(ADDR_TX_BYTES, data);
+      check_word(data, 32'h1ff);
+
+      bit_time    = CLK_PERIOD * (dut.DEFAULT_BIT_RATE + 1);
+      byte_errors = 0;
+
+      fork
+        begin
+          #(CLK_PERIOD);
+          tb_ch552_cts = 0;
+        end
+
+        for (i = 0; i < 511; i = i + 1) begin
+          receive_byte(bit_time, rx_data, stop_ok);
+          if ((rx_data != (((i * 37) ^ 8'h69) & 8'hff)) || !stop_ok) begin
+            byte_errors = byte_errors + 1;
+          end
+        end
+      join
+
+      $display("*** Transmitted 511 bytes from a full FIFO: %0d byte errors.", byte_errors);
+      error_ctr = error_ctr + byte_errors;
+
+      #(bit_time * 2);
+      read_word(ADDR_TX_BYTES, data);
+      check_word(data, 32'h0);
+    end
+  endtask  // test_tx_fifo_full
+
+
+  //----------------------------------------------------------------
+  // send_byte
+  //
+  // Quietly transmit a byte to the DUT receive port with bit_time
+  // time units per bit, followed by two stop bits.
+  //----------------------------------------------------------------
+  task send_byte(input [7 : 0] data, input integer bit_time);
+    integer i;
+    begin
+      tb_rxd = 0;
+      #(bit_time);
+
+      for (i = 0; i < 8; i = i + 1) begin
+        tb_rxd = data[i];
+        #(bit_time);
+      end
+
+      tb_rxd = 1;
+      #(2 * bit_time);
+    end
+  endtask  // send_byte
+
+
+  //----------------------------------------------------------------
+  // receive_byte
+  //
+  // Wait for a start bit on the DUT transmit port and sample the
+  // byte in the middle of each bit, with bit_time time units per
+  // bit. Clears stop_ok on a framing error.
+  //----------------------------------------------------------------
+  task receive_byte(input integer bit_time, output [7 : 0] data, output stop_ok);
+    integer i;
+    begin
+      @(negedge tb_txd);
+      #(bit_time / 2);
+
+      for (i = 0; i < 8; i = i + 1) begin
+        #(bit_time);
+        data[i] = tb_txd;
+      end
+
+      #(bit_time);
+      stop_ok = tb_txd;
+    end
+  endtask  // receive_byte
+
+
+  //----------------------------------------------------------------
+  // test_bit_rate
+  //
+  // Switch to 1 Mbps (a divisor of 23 gives 24 cycles per bit) and
+  // check that a reset goes back to the default. Check that the
+  // probe byte 0x55, used to confirm a new bit rate, is not received
+  // as 0x55 when the remote end is still at the old bit rate. Then
+  // send 256 bytes in each direction at the new bit rate, with the
+  // remote end 2% slow, exact and 2% fast, and count the bytes
+  // received in error.
+  //----------------------------------------------------------------
+  task test_bit_rate;
+    reg [31 : 0] data;
+    reg [ 7 : 0] rx_data;
+    reg          stop_ok;
+    integer      bit_time;
+    integer      byte_errors;
+    integer      i;
+    integer      j;
+    integer      k;
+    begin
+      tc_ctr = tc_ctr + 1;
+
+      $display("*** Switching bit rate.");
+      reset_dut();
+
+      read_word(ADDR_BIT_RATE, data);
+      check_word(data, 32'd48);
+
+      write_word(ADDR_BIT_RATE, 32'd23);
+      read_word(ADDR_BIT_RATE, data);
+      check_word(data, 32'd23);
+
+      reset_dut();
+      read_word(ADDR_BIT_RATE, data);
+      check_word(data, 32'd48);
+
+      write_word(ADDR_BIT_RATE, 32'd23);
+
+      send_byte(8'h55, CLK_PERIOD * 49);
+      #(CLK_PERIOD * 49 * 10);
+
+      read_word(ADDR_RX_BYTES, data);
+      if (data != 0) begin
+        read_word(ADDR_RX_DATA, data);
+        if (data[7 : 0] == 8'h55) begin
+          $display("*** Probe received at the wrong bit rate.");
+          error_ctr = error_ctr + 1;
+        end
+      end
+
+      read_word(ADDR_RX_BYTES, data);
+      while (data != 0) begin
+        read_word(ADDR_RX_DATA, data);
+        read_word(ADDR_RX_BYTES, data);
+      end
+
+      for (j = -1; j < 2; j = j + 1) begin
+        bit_time    = CLK_PERIOD * 24 + j;
+        byte_errors = 0;
+
+        for (i = 0; i < 256; i = i + 1) begin
+          send_byte((i * 73) ^ 8'h5a, bit_time);
+        end
+
+        for (i = 0; i < 256; i = i + 1) begin
+          read_word(ADDR_RX_DATA, data);
+          if (data[7 : 0] != (((i * 73) ^ 8'h5a) & 8'hff)) begin
+            byte_errors = byte_errors + 1;
+          end
+        end
+
+        read_word(ADDR_RX_BYTES, data);
+        byte_errors = byte_errors + data;
+
+        $display("*** Receive, %0d time units per bit: %0d byte errors.", bit_time, byte_errors);
+        error_ctr = error_ctr + byte_errors;
+
+        byte_errors = 0;
+
+        fork
+          for (i = 0; i < 256; i = i + 1) begin
+            write_word(ADDR_TX_DATA, (i * 73) ^ 8'h5a);
+          end
+
+          for (k = 0; k < 256; k = k + 1) begin
+            receive_byte(bit_time, rx_data, stop_ok);
+            if ((rx_data != (((k * 73) ^ 8'h5a) & 8'hff)) || !stop_ok) begin
+              byte_errors = byte_errors + 1;
+            end
+          end
+        join
+
+        $display("*** Transmit, %0d time units per bit: %0d byte errors.", bit_time, byte_errors);
+        error_ctr = error_ctr + byte_errors;
+      end
+
+      write_word(ADDR_BIT_RATE, 32'd48);
+    end
+  endtask  // test_bit_rate
+
+
   //----------------------------------------------------------------
   // display_test_result()
   //
@@ -441,6 +818,14 @@ module tb_uart ();
 
     send_framing_error();
 
+    test_rx_word();
+
+    test_tx_fifo();
+
+    test_tx_fifo_full();
+
+    test_bit_rate();
+
     display_test_result();
     $display("*** Simulation done.");
     exit_with_error_code();
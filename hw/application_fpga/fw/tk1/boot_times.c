@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <stdint.h>
+#include <tkey/assert.h>
+#include <tkey/debug.h>
+#include <tkey/lib.h>
+#include <tkey/perf.h>
+
+#include "boot_times.h"
+#include "memcheck.h"
+
+// Lives in FW_RAM, so it is kept until the next reset.
+static struct boot_times boot_times;
+
+// Record the cycle counter for phase.
+void boot_time(enum boot_phase phase)
+{
+	assert(phase < BOOT_PHASES);
+
+	boot_times.cycles[phase] = perf_cycles();
+}
+
+// Print the time of each phase, and the cycles since the previous
+// phase, on debug output.
+void boot_times_print(void)
+{
+	uint32_t prev = 0;
+
+	debug_puts("Boot times, cycles since reset and since previous:\n");
+	for (int i = 0; i < BOOT_PHASES; i++) {
+		debug_putinthex(boot_times.cycles[i]);
+		debug_putchar(' ');
+		debug_putinthex(boot_times.cycles[i] - prev);
+		debug_lf();
+		prev = boot_times.cycles[i];
+	}
+	(void)prev;
+}
+
+// Copy the boot times to times in app RAM.
+//
+// Returns 0 on success.
+int boot_times_get(struct boot_times *times)
+{
+	if (!in_app_ram(times, sizeof(*times))) {
+		return -1;
+	}
+
+	memcpy(times, &boot_times, sizeof(boot_times));
+
+	return 0;
+}
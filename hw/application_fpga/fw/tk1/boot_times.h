@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef BOOT_TIMES_H
+#define BOOT_TIMES_H
+
+#include <stdint.h>
+
+// Points in the boot where the cycle counter is recorded, in the
+// order they happen. Needs to be held synchronized with tkey-libs.
+enum boot_phase {
+	BOOT_MAIN = 0,	       // Entered main()
+	BOOT_SCRAMBLE_RAM = 1, // RAM fill started, scrambling set up
+	BOOT_PART_TABLE = 2,   // Partition table read, RAM filled
+	BOOT_LOAD_START = 3,   // Started loading the app
+	BOOT_LOADED = 4,       // App loaded and measured
+	BOOT_CDI = 5,	       // CDI computed
+	BOOT_JUMP = 6,	       // Jumping to the app
+	BOOT_PHASES = 7,
+};
+
+// Low 32 bits of the cycle counter at each phase, counting from
+// reset. A phase that wasn't reached is 0.
+struct boot_times {
+	uint32_t cycles[BOOT_PHASES];
+};
+
+void boot_time(enum boot_phase phase);
+void boot_times_print(void);
+int boot_times_get(struct boot_times *times);
+
+#endif
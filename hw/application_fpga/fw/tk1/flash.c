@@ -12,11 +12,24 @@
 
 #define PAGE_SIZE 256
 
-static bool flash_is_busy(void);
-static void flash_wait_busy(void);
+// JEDEC manufacturer IDs of memories known to support Dual Output
+// Fast Read with eight dummy clocks
+#define JEDEC_MACRONIX 0xC2
+#define JEDEC_GIGADEVICE 0xC8
+#define JEDEC_WINBOND 0xEF
+
+// The eight dummy clocks of Dual Output Fast Read are two bytes in
+// dual mode
+#define DUAL_DUMMY_SIZE 2
+
+// Read command used by flash_read_data() and flash_read_data_dma(),
+// zero until chosen by flash_read_cmd()
+static uint8_t read_cmd;
+
 static void flash_write_enable(void);
+static uint8_t flash_read_cmd(void);
 
-static bool flash_is_busy(void)
+bool flash_is_busy(void)
 {
 	uint8_t tx_buf = READ_STATUS_REG_1;
 	uint8_t rx_buf = {0x00};
@@ -32,7 +45,7 @@ static bool flash_is_busy(void)
 }
 
 // Blocking until !busy
-static void flash_wait_busy(void)
+void flash_wait_busy(void)
 {
 	while (flash_is_busy())
 		;
@@ -52,7 +65,10 @@ void flash_write_disable(void)
 	assert(spi_transfer(&tx_buf, sizeof(tx_buf), NULL, 0, NULL, 0) == 0);
 }
 
-void flash_sector_erase(uint32_t address)
+// Starts erasing the sector without waiting for it to finish. Use
+// flash_is_busy() to know when it's done. The flash can't be used
+// for anything else until then.
+void flash_sector_erase_start(uint32_t address)
 {
 	uint8_t tx_buf[4] = {0x00};
 	tx_buf[0] = SECTOR_ERASE;
@@ -62,10 +78,16 @@ void flash_sector_erase(uint32_t address)
 
 	flash_write_enable();
 	assert(spi_transfer(tx_buf, sizeof(tx_buf), NULL, 0, NULL, 0) == 0);
+}
+
+void flash_sector_erase(uint32_t address)
+{
+	flash_sector_erase_start(address);
 	flash_wait_busy();
 }
 
-void flash_block_32_erase(uint32_t address)
+// Starts a 32 KiB block erase, see flash_sector_erase_start().
+void flash_block_32_erase_start(uint32_t address)
 {
 	uint8_t tx_buf[4] = {0x00};
 	tx_buf[0] = BLOCK_ERASE_32K;
@@ -75,11 +97,17 @@ void flash_block_32_erase(uint32_t address)
 
 	flash_write_enable();
 	assert(spi_transfer(tx_buf, sizeof(tx_buf), NULL, 0, NULL, 0) == 0);
+}
+
+void flash_block_32_erase(uint32_t address)
+{
+	flash_block_32_erase_start(address);
 	flash_wait_busy();
 }
 
-// 64 KiB block erase, only cares about address bits 16 and above.
-void flash_block_64_erase(uint32_t address)
+// Starts a 64 KiB block erase, see flash_sector_erase_start(). Only
+// cares about address bits 16 and above.
+void flash_block_64_erase_start(uint32_t address)
 {
 	uint8_t tx_buf[4] = {0x00};
 	tx_buf[0] = BLOCK_ERASE_64K;
@@ -89,6 +117,12 @@ void flash_block_64_erase(uint32_t address)
 
 	flash_write_enable();
 	assert(spi_transfer(tx_buf, sizeof(tx_buf), NULL, 0, NULL, 0) == 0);
+}
+
+// 64 KiB block erase, only cares about address bits 16 and above.
+void flash_block_64_erase(uint32_t address)
+{
+	flash_block_64_erase_start(address);
 	flash_wait_busy();
 }
 
@@ -153,6 +187,34 @@ void flash_read_status(uint8_t *status_reg)
 			    1) == 0);
 }
 
+// Chooses the read command the first time it's called. Dual Output
+// Fast Read is used if both the memory, identified by its JEDEC ID,
+// and the SPI-master supports it. Otherwise falls back to Read Data.
+//
+// The SPI clock is far below what Read Data allows, so plain Fast
+// Read would only add a dummy byte and is not used.
+static uint8_t flash_read_cmd(void)
+{
+	if (read_cmd != 0) {
+		return read_cmd;
+	}
+
+	uint8_t jedec_id[3] = {0x00};
+
+	flash_read_jedec_id(jedec_id);
+
+	read_cmd = READ_DATA;
+
+	if (jedec_id[0] == JEDEC_WINBOND || jedec_id[0] == JEDEC_MACRONIX ||
+	    jedec_id[0] == JEDEC_GIGADEVICE) {
+		if (spi_dual_supported()) {
+			read_cmd = FAST_READ_DUAL_OUTPUT;
+		}
+	}
+
+	return read_cmd;
+}
+
 int flash_read_data(uint32_t address, uint8_t *dest_buf, size_t size)
 {
 	if (dest_buf == NULL) {
@@ -160,16 +222,59 @@ int flash_read_data(uint32_t address, uint8_t *dest_buf, size_t size)
 	}
 
 	uint8_t tx_buf[4] = {0x00};
-	tx_buf[0] = READ_DATA;
+	tx_buf[0] = flash_read_cmd();
 	tx_buf[1] = (address >> ADDR_BYTE_3_BIT) & 0xFF;
 	tx_buf[2] = (address >> ADDR_BYTE_2_BIT) & 0xFF;
 	tx_buf[3] = (address >> ADDR_BYTE_1_BIT) & 0xFF;
 
+	if (tx_buf[0] == FAST_READ_DUAL_OUTPUT) {
+		return spi_dual_transfer(tx_buf, sizeof(tx_buf),
+					 DUAL_DUMMY_SIZE, dest_buf, size);
+	}
+
 	return spi_transfer(tx_buf, sizeof(tx_buf), NULL, 0, dest_buf, size);
 }
 
-// Only handles writes where the least significant byte of the start address is
-// zero.
+// Starts reading size bytes at address straight into app RAM at
+// dest_buf in the background, see spi_dma_start().
+int flash_read_data_dma(uint32_t address, uint8_t *dest_buf, size_t size)
+{
+	uint8_t tx_buf[4] = {0x00};
+	tx_buf[0] = flash_read_cmd();
+	tx_buf[1] = (address >> ADDR_BYTE_3_BIT) & 0xFF;
+	tx_buf[2] = (address >> ADDR_BYTE_2_BIT) & 0xFF;
+	tx_buf[3] = (address >> ADDR_BYTE_1_BIT) & 0xFF;
+
+	if (tx_buf[0] == FAST_READ_DUAL_OUTPUT) {
+		return spi_dual_dma_start(tx_buf, sizeof(tx_buf),
+					  DUAL_DUMMY_SIZE, dest_buf, size);
+	}
+
+	return spi_dma_start(tx_buf, sizeof(tx_buf), dest_buf, size);
+}
+
+// Returns true if flash_read_data_dma() can be used.
+bool flash_dma_supported(void)
+{
+	return spi_dma_supported();
+}
+
+// Returns the end of the data read into RAM so far by
+// flash_read_data_dma().
+uint8_t *flash_read_data_dma_progress(void)
+{
+	return spi_dma_progress();
+}
+
+// Stops a read started by flash_read_data_dma() and releases the
+// flash. Must be called when the read is done, too.
+void flash_read_data_dma_stop(void)
+{
+	spi_dma_stop();
+}
+
+// Writes size bytes of data to flash at address. The address and
+// size can be anything, the write is split at page boundaries.
 int flash_write_data(uint32_t address, uint8_t *data, size_t size)
 {
 	if (data == NULL) {
@@ -180,34 +285,34 @@ int flash_write_data(uint32_t address, uint8_t *data, size_t size)
 		return -1;
 	}
 
-	if (address % 256 != 0) {
-		return -1;
-	}
-
 	size_t left = size;
 	uint8_t *p_data = data;
 	size_t n_bytes = 0;
 
 	// Page Program allows 1-256 bytes of a page to be written. A page is
 	// 256 bytes. Behavior when writing past the end of a page is device
-	// specific.
+	// specific, the address wraps around within the page on most.
 	//
-	// We set the address LSByte to 0 and only write 256 bytes or less in
-	// each transfer.
+	// We never write past the end of the page, so the first transfer
+	// only goes up to the next page boundary and the rest are at most a
+	// page each.
 	uint8_t tx_buf[4] = {
-	    PAGE_PROGRAM,			 /* tx_buf[0] */
-	    (address >> ADDR_BYTE_3_BIT) & 0xFF, /* tx_buf[1] */
-	    (address >> ADDR_BYTE_2_BIT) & 0xFF, /* tx_buf[2] */
-	    0x00,				 /* tx_buf[3] */
+	    PAGE_PROGRAM, /* tx_buf[0] */
+	    0x00,	  /* tx_buf[1] */
+	    0x00,	  /* tx_buf[2] */
+	    0x00,	  /* tx_buf[3] */
 	};
 
 	while (left > 0) {
-		if (left >= PAGE_SIZE) {
-			n_bytes = PAGE_SIZE;
-		} else {
+		n_bytes = PAGE_SIZE - (address % PAGE_SIZE);
+		if (left < n_bytes) {
 			n_bytes = left;
 		}
 
+		tx_buf[1] = (address >> ADDR_BYTE_3_BIT) & 0xFF;
+		tx_buf[2] = (address >> ADDR_BYTE_2_BIT) & 0xFF;
+		tx_buf[3] = (address >> ADDR_BYTE_1_BIT) & 0xFF;
+
 		flash_write_enable();
 
 		if (spi_transfer(tx_buf, sizeof(tx_buf), p_data, n_bytes, NULL,
@@ -217,10 +322,7 @@ int flash_write_data(uint32_t address, uint8_t *data, size_t size)
 
 		left -= n_bytes;
 		p_data += n_bytes;
-
 		address += n_bytes;
-		tx_buf[1] = (address >> ADDR_BYTE_3_BIT) & 0xFF;
-		tx_buf[2] = (address >> ADDR_BYTE_2_BIT) & 0xFF;
 
 		flash_wait_busy();
 	}
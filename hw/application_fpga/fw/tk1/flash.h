@@ -23,6 +23,8 @@
 
 #define POWER_DOWN 0xB9
 #define READ_DATA 0x03
+#define FAST_READ 0x0B
+#define FAST_READ_DUAL_OUTPUT 0x3B
 #define RELEASE_POWER_DOWN 0xAB
 
 #define READ_MANUFACTURER_ID 0x90
@@ -39,9 +41,19 @@
 #define STATUS_REG_BUSY_BIT 0
 #define STATUS_REG_WEL_BIT 1
 
+// Sizes of what the erase commands erase
+#define SECTOR_SIZE 0x1000UL	// 4 KiB
+#define BLOCK_32_SIZE 0x8000UL	// 32 KiB
+#define BLOCK_64_SIZE 0x10000UL // 64 KiB
+
+bool flash_is_busy(void);
+void flash_wait_busy(void);
 void flash_write_disable(void);
+void flash_sector_erase_start(uint32_t address);
 void flash_sector_erase(uint32_t address);
+void flash_block_32_erase_start(uint32_t address);
 void flash_block_32_erase(uint32_t address);
+void flash_block_64_erase_start(uint32_t address);
 void flash_block_64_erase(uint32_t address);
 void flash_release_powerdown(void);
 void flash_powerdown(void);
@@ -50,6 +62,10 @@ void flash_read_jedec_id(uint8_t *jedec_id);
 void flash_read_unique_id(uint8_t *unique_id);
 void flash_read_status(uint8_t *status_reg);
 int flash_read_data(uint32_t address, uint8_t *dest_buf, size_t size);
+bool flash_dma_supported(void);
+int flash_read_data_dma(uint32_t address, uint8_t *dest_buf, size_t size);
+uint8_t *flash_read_data_dma_progress(void);
+void flash_read_data_dma_stop(void);
 int flash_write_data(uint32_t address, uint8_t *data, size_t size);
 
 #endif
@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <tkey/lib.h>
+
+#include "lz.h"
+
+// Decoder states. A sequence is a token, an optional literal length
+// extension, literals, a 16 bit match offset and an optional match
+// length extension. The last sequence of a block has no match.
+enum lz_state {
+	LZ_TOKEN,
+	LZ_LITLEN,
+	LZ_LITERALS,
+	LZ_OFFSET_LO,
+	LZ_OFFSET_HI,
+	LZ_MATCHLEN,
+	LZ_DONE,
+};
+
+static int lz_match(struct lz *lz);
+
+// lz_header returns the decompressed size if buf starts with a
+// compressed app header, otherwise 0.
+uint32_t lz_header(const uint8_t *buf, size_t size)
+{
+	if (buf == NULL || size < LZ_HEADER_SIZE) {
+		return 0;
+	}
+
+	if (buf[0] != 0 || buf[1] != 0 || buf[2] != 'L' || buf[3] != 'Z') {
+		return 0;
+	}
+
+	return buf[4] + (buf[5] << 8) + (buf[6] << 16) + (buf[7] << 24);
+}
+
+// lz_init prepares lz to decompress exactly size bytes to dst.
+void lz_init(struct lz *lz, uint8_t *dst, uint32_t size)
+{
+	lz->start = dst;
+	lz->out = dst;
+	lz->end = dst + size;
+	lz->len = 0;
+	lz->offset = 0;
+	lz->token = 0;
+	lz->state = LZ_TOKEN;
+}
+
+// lz_decode decompresses the next size bytes of the compressed
+// stream. The stream can be split anywhere between calls.
+//
+// Returns 0 on success, -1 if the stream is corrupt, would write
+// outside of the output or reference data before the start of it.
+int lz_decode(struct lz *lz, const uint8_t *in, size_t size)
+{
+	const uint8_t *in_end = in + size;
+	uint32_t n = 0;
+
+	while (in < in_end) {
+		switch (lz->state) {
+		case LZ_TOKEN:
+			lz->token = *in++;
+			lz->len = lz->token >> 4;
+			lz->state = lz->len == 15 ? LZ_LITLEN : LZ_LITERALS;
+			break;
+
+		case LZ_LITLEN:
+			lz->len += *in;
+			if (*in++ != 255) {
+				lz->state = LZ_LITERALS;
+			}
+			break;
+
+		case LZ_LITERALS:
+			n = (uint32_t)(in_end - in);
+			if (n > lz->len) {
+				n = lz->len;
+			}
+
+			if (n > (uint32_t)(lz->end - lz->out)) {
+				return -1;
+			}
+
+			memcpy(lz->out, in, n);
+			lz->out += n;
+			in += n;
+			lz->len -= n;
+
+			if (lz->len == 0) {
+				lz->state = lz->out == lz->end ? LZ_DONE
+							       : LZ_OFFSET_LO;
+			}
+			break;
+
+		case LZ_OFFSET_LO:
+			lz->offset = *in++;
+			lz->state = LZ_OFFSET_HI;
+			break;
+
+		case LZ_OFFSET_HI:
+			lz->offset |= *in++ << 8;
+			lz->len = lz->token & 0xf;
+			if (lz->len == 15) {
+				lz->state = LZ_MATCHLEN;
+			} else if (lz_match(lz) != 0) {
+				return -1;
+			}
+			break;
+
+		case LZ_MATCHLEN:
+			lz->len += *in;
+			if (*in++ != 255 && lz_match(lz) != 0) {
+				return -1;
+			}
+			break;
+
+		default:
+			// Trailing data after the end of the block
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+// lz_done returns true if all of the output has been decompressed.
+bool lz_done(const struct lz *lz)
+{
+	return lz->state == LZ_DONE;
+}
+
+// Copies the current match. It may overlap the output, so copy byte
+// by byte.
+static int lz_match(struct lz *lz)
+{
+	uint32_t len = lz->len + 4;
+
+	if (lz->offset == 0 ||
+	    lz->offset > (uint32_t)(lz->out - lz->start)) {
+		return -1;
+	}
+
+	if (len > (uint32_t)(lz->end - lz->out)) {
+		return -1;
+	}
+
+	const uint8_t *src = lz->out - lz->offset;
+	while (len-- > 0) {
+		*lz->out++ = *src++;
+	}
+
+	lz->state = lz->out == lz->end ? LZ_DONE : LZ_TOKEN;
+
+	return 0;
+}
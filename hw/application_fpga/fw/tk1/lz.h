@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef LZ_H
+#define LZ_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A compressed app starts with this header: two zero bytes (an
+// illegal instruction, so no runnable app can start like this), "LZ"
+// and the decompressed size as a 32 bit little endian word. An LZ4
+// block follows.
+#define LZ_HEADER_SIZE 8
+
+// Streaming LZ4 block decoder state
+struct lz {
+	uint8_t *start;	 // Start of output
+	uint8_t *out;	 // Next byte to write
+	uint8_t *end;	 // End of output
+	uint32_t len;	 // Length of current literal run or match
+	uint16_t offset; // Offset of current match
+	uint8_t token;	 // Current sequence token
+	uint8_t state;
+};
+
+uint32_t lz_header(const uint8_t *buf, size_t size);
+void lz_init(struct lz *lz, uint8_t *dst, uint32_t size);
+int lz_decode(struct lz *lz, const uint8_t *in, size_t size);
+bool lz_done(const struct lz *lz);
+
+#endif
@@ -11,6 +11,8 @@
 #include <tkey/lib.h>
 #include <tkey/tk1_mem.h>
 
+#include "boot_times.h"
+#include "lz.h"
 #include "mgmt_app.h"
 #include "partition_table.h"
 #include "preload_app.h"
@@ -39,6 +41,9 @@ static volatile uint32_t *timer_status     = (volatile uint32_t *)TK1_MMIO_TIMER
 static volatile uint32_t *timer_ctrl       = (volatile uint32_t *)TK1_MMIO_TIMER_CTRL;
 static volatile uint32_t *ram_addr_rand    = (volatile uint32_t *)TK1_MMIO_TK1_RAM_ADDR_RAND;
 static volatile uint32_t *ram_data_rand    = (volatile uint32_t *)TK1_MMIO_TK1_RAM_DATA_RAND;
+static volatile uint32_t *ram_fill_state   = (volatile uint32_t *)TK1_MMIO_TK1_RAM_FILL_STATE;
+static volatile uint32_t *ram_fill_acc     = (volatile uint32_t *)TK1_MMIO_TK1_RAM_FILL_ACC;
+static volatile uint32_t *ram_fill         = (volatile uint32_t *)TK1_MMIO_TK1_RAM_FILL;
 static volatile struct reset *resetinfo    = (volatile struct reset *)TK1_MMIO_RESETINFO_BASE;
 // clang-format on
 
@@ -46,6 +51,7 @@ struct partition_table_storage part_table_storage;
 
 // Context for the loading of a TKey program
 struct context {
+	uint32_t sent_size; // Bytes the client sends, compressed or not
 	uint32_t left;	    // Bytes left to receive
 	uint8_t digest[32]; // Program digest
 	uint8_t *loadaddr;  // Where we are currently loading a TKey program
@@ -54,6 +60,11 @@ struct context {
 	uint8_t flash_slot; // App is loaded from flash slot number
 	/*@null@*/ volatile uint8_t
 	    *ver_digest; // Verify loaded app against this digest
+	// Running digest of an app loaded from the client
+	blake2s_ctx digest_ctx;
+	uint16_t stream_frames; // Streamed app frames received so far
+	bool compressed;	// App is sent compressed?
+	struct lz lz;		// Decompression state, if compressed
 };
 
 static void print_hw_version(void);
@@ -68,11 +79,10 @@ static enum state initial_commands(const struct frame_header *hdr,
 static enum state loading_commands(const struct frame_header *hdr,
 				   const uint8_t *cmd, enum state state,
 				   struct context *ctx);
-#if !defined(SIMULATION)
-static uint32_t xorwow(uint32_t state, uint32_t acc);
-#endif
+static int load_chunk(struct context *ctx, const uint8_t *data,
+		      uint32_t nbytes);
 static void scramble_ram(void);
-static int compute_app_digest(uint8_t *digest);
+static void ram_fill_wait(void);
 static int load_flash_app(struct partition_table *part_table,
 			  uint8_t digest[32], uint8_t slot);
 static enum state start_where(struct context *ctx);
@@ -253,7 +263,16 @@ static enum state initial_commands(const struct frame_header *hdr,
 		assert(*app_size != 0);
 		assert(*app_size <= TK1_APP_MAX_SIZE);
 
+		ctx->sent_size = *app_size;
 		ctx->left = *app_size;
+		ctx->compressed = false;
+
+		boot_time(BOOT_LOAD_START);
+
+		// The app is measured chunk by chunk as it arrives,
+		// see loading_commands().
+		int blake2err = blake2s_init(&ctx->digest_ctx, 32, NULL, 0);
+		assert(blake2err == 0);
 
 		led_set(LED_BLACK);
 
@@ -281,6 +300,8 @@ static enum state loading_commands(const struct frame_header *hdr,
 
 	switch (cmd[0]) {
 	case FW_CMD_LOAD_APP_DATA:
+		// fallthrough
+	case FW_CMD_LOAD_APP_STREAM:
 		debug_puts("cmd: load-app-data\n");
 		if (hdr->len != 128) {
 			// Bad length
@@ -288,28 +309,78 @@ static enum state loading_commands(const struct frame_header *hdr,
 			break;
 		}
 
+		if (cmd[0] == FW_CMD_LOAD_APP_STREAM) {
+			// 127 bytes per frame of what the client said
+			// it would send. *app_size is the decompressed
+			// size once a compressed app has started.
+			uint32_t max_frames = (ctx->sent_size + 126) / 127;
+
+			if (ctx->stream_frames >= max_frames) {
+				debug_puts("Too many streamed frames\n");
+				state = FW_STATE_FAIL;
+				break;
+			}
+
+			// Streamed frames are only acknowledged once
+			// per window, so a lost or repeated frame is
+			// detected by the frame ID not following the
+			// previous one.
+			if (hdr->id != (ctx->stream_frames & 0x3)) {
+				debug_puts("Out of sequence frame\n");
+				rsp[0] = STATUS_BAD;
+				rsp[1] = ctx->stream_frames & 0xff;
+				rsp[2] = ctx->stream_frames >> 8;
+				fwreply(*hdr, FW_RSP_LOAD_APP_STREAM, rsp);
+				state = FW_STATE_FAIL;
+				break;
+			}
+
+			ctx->stream_frames++;
+		}
+
 		if (ctx->left > (128 - 1)) {
 			nbytes = 128 - 1;
 		} else {
 			nbytes = ctx->left;
 		}
-		memcpy_s(ctx->loadaddr, ctx->left, cmd + 1, nbytes);
-		/*@-mustfreeonly@*/
-		ctx->loadaddr += nbytes;
-		/*@+mustfreeonly@*/
+
+		// Everything before loadaddr has been measured, except
+		// what this chunk adds.
+		uint8_t *measured = ctx->loadaddr;
+
+		if (load_chunk(ctx, cmd + 1, nbytes) != 0) {
+			debug_puts("Bad app data\n");
+			rsp[0] = STATUS_BAD;
+			fwreply(*hdr,
+				cmd[0] == FW_CMD_LOAD_APP_DATA
+				    ? FW_RSP_LOAD_APP_DATA
+				    : FW_RSP_LOAD_APP_STREAM,
+				rsp);
+			state = FW_STATE_FAIL;
+			break;
+		}
 		ctx->left -= nbytes;
 
 		if (ctx->left == 0) {
-			int blake2err = 0;
+			if (ctx->compressed && !lz_done(&ctx->lz)) {
+				debug_puts("Compressed app truncated\n");
+				rsp[0] = STATUS_BAD;
+				fwreply(*hdr, FW_RSP_LOAD_APP_DATA_READY, rsp);
+				state = FW_STATE_FAIL;
+				break;
+			}
 
 			debug_puts("Fully loaded ");
 			debug_putinthex(*app_size);
 			debug_lf();
 
-			// Compute Blake2S digest of the app,
-			// storing it for FW_STATE_RUN
-			blake2err = compute_app_digest(ctx->digest);
-			assert(blake2err == 0);
+			// Measure the last chunk and finalize the
+			// Blake2S digest of the app, storing it for
+			// FW_STATE_RUN
+			blake2s_update(&ctx->digest_ctx, measured,
+				       ctx->loadaddr - measured);
+			blake2s_final(&ctx->digest_ctx, ctx->digest);
+			boot_time(BOOT_LOADED);
 			print_digest(ctx->digest);
 
 			// And return the digest in final
@@ -322,8 +393,24 @@ static enum state loading_commands(const struct frame_header *hdr,
 			break;
 		}
 
-		rsp[0] = STATUS_OK;
-		fwreply(*hdr, FW_RSP_LOAD_APP_DATA, rsp);
+		// Measure what landed in RAM before replying, so the
+		// chunk is in the digest before the client may send
+		// the next one. Streamed frames within a window aren't
+		// replied to, so the client keeps sending meanwhile.
+		blake2s_update(&ctx->digest_ctx, measured,
+			       ctx->loadaddr - measured);
+
+		if (cmd[0] == FW_CMD_LOAD_APP_DATA) {
+			rsp[0] = STATUS_OK;
+			fwreply(*hdr, FW_RSP_LOAD_APP_DATA, rsp);
+		} else if (ctx->stream_frames % STREAM_WINDOW == 0) {
+			// Cumulative ack for the whole window
+			rsp[0] = STATUS_OK;
+			rsp[1] = ctx->stream_frames & 0xff;
+			rsp[2] = ctx->stream_frames >> 8;
+			fwreply(*hdr, FW_RSP_LOAD_APP_STREAM, rsp);
+		}
+
 		// still loading state
 		break;
 
@@ -338,8 +425,55 @@ static enum state loading_commands(const struct frame_header *hdr,
 	return state;
 }
 
+// Writes a chunk of an app loaded from the client to RAM. If the
+// first chunk starts with a compressed app header the rest of the
+// app is decompressed on the way instead, see lz.h.
+//
+// Returns 0 on success.
+static int load_chunk(struct context *ctx, const uint8_t *data,
+		      uint32_t nbytes)
+{
+	if (!ctx->compressed && ctx->loadaddr == (uint8_t *)TK1_RAM_BASE) {
+		uint32_t size = lz_header(data, nbytes);
+
+		if (size != 0) {
+			if (size > TK1_APP_MAX_SIZE) {
+				return -1;
+			}
+
+			// The app gets to know its real size
+			*app_size = size;
+			lz_init(&ctx->lz, ctx->loadaddr, size);
+			ctx->compressed = true;
+			data += LZ_HEADER_SIZE;
+			nbytes -= LZ_HEADER_SIZE;
+		}
+	}
+
+	if (ctx->compressed) {
+		if (lz_decode(&ctx->lz, data, nbytes) != 0) {
+			return -1;
+		}
+		/*@-mustfreeonly@*/
+		ctx->loadaddr = ctx->lz.out;
+		/*@+mustfreeonly@*/
+
+		return 0;
+	}
+
+	memcpy_s(ctx->loadaddr, ctx->left, data, nbytes);
+	/*@-mustfreeonly@*/
+	ctx->loadaddr += nbytes;
+	/*@+mustfreeonly@*/
+
+	return 0;
+}
+
 static void jump_to_app(void)
 {
+	boot_time(BOOT_JUMP);
+	boot_times_print();
+
 	/* Start of app is always at the beginning of RAM */
 	*app_addr = TK1_RAM_BASE;
 
@@ -388,49 +522,32 @@ static int load_flash_app(struct partition_table *part_table,
 		return -1;
 	}
 
-	if (preload_load(part_table, slot) == -1) {
+	uint32_t size = 0;
+	if (preload_load(part_table, slot, &size, digest) == -1) {
 		return -1;
 	}
 
-	*app_size = part_table->pre_app_data[slot].size;
+	*app_size = size;
 	if (*app_size > TK1_APP_MAX_SIZE) {
 		return -1;
 	}
 
-	int digest_err = compute_app_digest(digest);
-	assert(digest_err == 0);
 	print_digest(digest);
 
 	return 0;
 }
 
-#if !defined(SIMULATION)
-static uint32_t xorwow(uint32_t state, uint32_t acc)
-{
-	state ^= state << 13;
-	state ^= state >> 17;
-	state ^= state << 5;
-	state += acc;
-	return state;
-}
-#endif
-
 static void scramble_ram(void)
 {
 	// Can't fill RAM if we are simulating, data has already been loaded
 	// into RAM.
 #if !defined(SIMULATION)
-	uint32_t *ram = (uint32_t *)(TK1_RAM_BASE);
-
-	// Fill RAM with random data
-	// Get random state and accumulator seeds.
-	uint32_t data_state = rnd_word();
-	uint32_t data_acc = rnd_word();
-
-	for (uint32_t w = 0; w < TK1_RAM_SIZE / 4; w++) {
-		data_state = xorwow(data_state, data_acc);
-		ram[w] = data_state;
-	}
+	// Start filling RAM with random data. The RAM core fills it
+	// with the xorwow PRNG in the background, one word per cycle,
+	// from random state and accumulator seeds.
+	*ram_fill_state = rnd_word();
+	*ram_fill_acc = rnd_word();
+	*ram_fill = 1;
 #endif
 
 	// Set RAM address and data scrambling parameters
@@ -438,11 +555,12 @@ static void scramble_ram(void)
 	*ram_data_rand = rnd_word();
 }
 
-/* Computes the blake2s digest of the app loaded into RAM */
-static int compute_app_digest(uint8_t *digest)
+// Wait for the RAM fill started by scramble_ram() to finish.
+// Anything written to RAM before that might be overwritten.
+static void ram_fill_wait(void)
 {
-	return blake2s(digest, 32, NULL, 0, (const void *)TK1_RAM_BASE,
-		       *app_size);
+	while ((*ram_fill & (1 << TK1_MMIO_TK1_RAM_FILL_BUSY_BIT)) != 0) {
+	}
 }
 
 static enum state start_where(struct context *ctx)
@@ -517,6 +635,8 @@ int main(void)
 	uint8_t cmd[CMDSIZE] = {0};
 	enum state state = FW_STATE_INITIAL;
 
+	boot_time(BOOT_MAIN);
+
 	print_hw_version();
 
 	/*@-mustfreeonly@*/
@@ -528,12 +648,17 @@ int main(void)
 	ctx.use_uss = false;
 
 	scramble_ram();
+	boot_time(BOOT_SCRAMBLE_RAM);
 
+	// The partition table is read to FW_RAM, so it's read while
+	// RAM is being filled.
 	if (part_table_read(&part_table_storage) != 0) {
 		// Couldn't read partition table
 		debug_puts("Couldn't read partition table\n");
 		assert(1 == 2);
 	}
+	ram_fill_wait();
+	boot_time(BOOT_PART_TABLE);
 
 	// Reset the USB controller to only enable the USB CDC
 	// endpoint and the internal command channel.
@@ -573,23 +698,27 @@ int main(void)
 			break;
 
 		case FW_STATE_LOAD_FLASH:
+			boot_time(BOOT_LOAD_START);
 			if (load_flash_app(&part_table_storage.table,
 					   ctx.digest, ctx.flash_slot) < 0) {
 				debug_puts("Couldn't load app from flash\n");
 				state = FW_STATE_FAIL;
 				break;
 			}
+			boot_time(BOOT_LOADED);
 
 			state = FW_STATE_START;
 			break;
 
 		case FW_STATE_LOAD_FLASH_MGMT:
+			boot_time(BOOT_LOAD_START);
 			if (load_flash_app(&part_table_storage.table,
 					   ctx.digest, ctx.flash_slot) < 0) {
 				debug_puts("Couldn't load app from flash\n");
 				state = FW_STATE_FAIL;
 				break;
 			}
+			boot_time(BOOT_LOADED);
 
 			if (mgmt_app_init(ctx.digest) != 0) {
 				state = FW_STATE_FAIL;
@@ -618,6 +747,7 @@ int main(void)
 				compute_cdi(domain, ctx.digest, ctx.use_uss,
 					    ctx.uss);
 			}
+			boot_time(BOOT_CDI);
 
 			// Reset resetinfo to default. Leave
 			// next_app_data intact, if any. We also leave
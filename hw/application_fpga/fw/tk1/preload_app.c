@@ -1,28 +1,41 @@
 // SPDX-FileCopyrightText: 2024 Tillitis AB <tillitis.se>
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <blake2s/blake2s.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <tkey/assert.h>
 #include <tkey/debug.h>
 #include <tkey/lib.h>
 #include <tkey/tk1_mem.h>
 
 #include "flash.h"
+#include "lz.h"
 #include "memcheck.h"
 #include "mgmt_app.h"
 #include "partition_table.h"
 #include "preload_app.h"
 
+// Polls of the SPI DMA without any new data before giving up. A word
+// normally arrives within a few polls.
+#define DMA_STALL_POLLS 100000
+
 static uint32_t slot_to_start_address(uint8_t slot)
 {
 	return ADDR_PRE_LOADED_APP_0 + slot * SIZE_PRE_LOADED_APP;
 }
 
-// Loads a preloaded app from flash to app RAM
-int preload_load(struct partition_table *part_table, uint8_t from_slot)
+static int load_measure(uint32_t address, uint8_t *loadaddr, uint32_t size,
+			uint8_t digest[32]);
+
+// Loads a preloaded app from flash to app RAM, decompressing it if
+// it is stored compressed, and measures it. The size of the app in
+// RAM is returned in app_size and its digest in digest.
+int preload_load(struct partition_table *part_table, uint8_t from_slot,
+		 uint32_t *app_size, uint8_t digest[32])
 {
-	if (part_table == NULL) {
+	if (part_table == NULL || app_size == NULL || digest == NULL) {
 		return -1;
 	}
 
@@ -36,17 +49,117 @@ int preload_load(struct partition_table *part_table, uint8_t from_slot)
 		return -1;
 	}
 	uint8_t *loadaddr = (uint8_t *)TK1_RAM_BASE;
+	uint32_t address = slot_to_start_address(from_slot);
+	uint32_t left = part_table->pre_app_data[from_slot].size;
+	uint8_t buf[128];
+
+	if (flash_read_data(address, buf, LZ_HEADER_SIZE) != 0) {
+		return -1;
+	}
+
+	*app_size = lz_header(buf, LZ_HEADER_SIZE);
+	if (*app_size == 0) {
+		*app_size = left;
+
+		return load_measure(address, loadaddr, left, digest);
+	}
+
+	if (*app_size > TK1_APP_MAX_SIZE || left <= LZ_HEADER_SIZE) {
+		return -1;
+	}
+
+	struct lz lz;
+	lz_init(&lz, loadaddr, *app_size);
+	address += LZ_HEADER_SIZE;
+	left -= LZ_HEADER_SIZE;
+
+	while (left > 0) {
+		uint32_t n = left > sizeof(buf) ? sizeof(buf) : left;
+
+		if (flash_read_data(address, buf, n) != 0) {
+			return -1;
+		}
+
+		if (lz_decode(&lz, buf, n) != 0) {
+			return -1;
+		}
+
+		address += n;
+		left -= n;
+	}
+
+	if (!lz_done(&lz)) {
+		return -1;
+	}
+
+	return blake2s(digest, 32, NULL, 0, loadaddr, *app_size);
+}
+
+// Reads size bytes at address in flash straight into RAM at
+// loadaddr using the SPI DMA and measures the data as it arrives.
+// Without the DMA the app is read first and measured afterwards.
+static int load_measure(uint32_t address, uint8_t *loadaddr, uint32_t size,
+			uint8_t digest[32])
+{
+	uint32_t words = size & ~3UL;
+	uint8_t *measured = loadaddr;
+	uint32_t stalled = 0;
+	blake2s_ctx ctx;
+
+	if (!flash_dma_supported()) {
+		if (flash_read_data(address, loadaddr, size) != 0) {
+			return -1;
+		}
+
+		return blake2s(digest, 32, NULL, 0, loadaddr, size);
+	}
+
+	int blake2err = blake2s_init(&ctx, 32, NULL, 0);
+	assert(blake2err == 0);
+
+	if (words != 0) {
+		if (flash_read_data_dma(address, loadaddr, words) != 0) {
+			return -1;
+		}
 
-	// Read from flash, straight into RAM
-	int ret = flash_read_data(slot_to_start_address(from_slot), loadaddr,
-				  part_table->pre_app_data[from_slot].size);
+		while (measured != loadaddr + words) {
+			uint8_t *arrived = flash_read_data_dma_progress();
 
-	return ret;
+			if (arrived < measured || arrived > loadaddr + words ||
+			    (arrived == measured && ++stalled > DMA_STALL_POLLS)) {
+				flash_read_data_dma_stop();
+				return -1;
+			}
+
+			if (arrived != measured) {
+				stalled = 0;
+			}
+
+			blake2s_update(&ctx, measured, arrived - measured);
+			measured = arrived;
+		}
+
+		flash_read_data_dma_stop();
+	}
+
+	// Trailing bytes that don't make up a whole word
+	if (size != words) {
+		if (flash_read_data(address + words, loadaddr + words,
+				    size - words) != 0) {
+			return -1;
+		}
+
+		blake2s_update(&ctx, measured, size - words);
+	}
+
+	blake2s_final(&ctx, digest);
+
+	return 0;
 }
 
 // preload_store stores chunks of an app in app slot to_slot. data is a buffer
 // of size size to be written at byte offset in the slot. offset needs to be
-// kept and updated between each call. offset must be a multiple of 256.
+// kept and updated between each call.
 //
 // When all data has been written call preload_store_finalize() with the last
 // parameters.
@@ -9,7 +9,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
-int preload_load(struct partition_table *part_table, uint8_t from_slot);
+int preload_load(struct partition_table *part_table, uint8_t from_slot,
+		 uint32_t *app_size, uint8_t digest[32]);
 int preload_store(struct partition_table *part_table, uint32_t offset,
 		  uint8_t *data, size_t size, uint8_t to_slot);
 int preload_store_finalize(struct partition_table_storage *part_table_storage,
@@ -126,6 +126,10 @@ void fwreply(struct frame_header hdr, enum fwcmd rspcode, uint8_t *buf)
 		len = LEN_128;
 		break;
 
+	case FW_RSP_LOAD_APP_STREAM:
+		len = LEN_4;
+		break;
+
 	case FW_RSP_GET_UDI:
 		len = LEN_32;
 		break;
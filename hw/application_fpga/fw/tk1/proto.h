@@ -34,10 +34,25 @@ enum fwcmd {
 	FW_RSP_LOAD_APP_DATA_READY	= 0x07,
 	FW_CMD_GET_UDI			= 0x08,
 	FW_RSP_GET_UDI			= 0x09,
-	FW_CMD_MAX                      = 0x0a,
+	FW_CMD_LOAD_APP_STREAM		= 0x0a,
+	FW_RSP_LOAD_APP_STREAM		= 0x0b,
+	FW_CMD_MAX                      = 0x0c,
 };
 // clang-format on
 
+// Number of FW_CMD_LOAD_APP_STREAM frames the client may send before
+// waiting for a cumulative FW_RSP_LOAD_APP_STREAM.
+//
+// A window must fit in the 512 byte UART receive FIFO, since the
+// CH552 doesn't stop sending when the FPGA CTS says the FIFO is full.
+// A 129 byte frame is split into at most three USB Mode Protocol
+// packets with 2 byte headers, so 3 frames are at most 405 bytes.
+//
+// It also keeps the window shorter than the 4 frame IDs. Losing a
+// whole window means no acknowledgement instead of an undetected
+// wrap around.
+#define STREAM_WINDOW 3
+
 enum status {
 	STATUS_OK,
 	STATUS_BAD
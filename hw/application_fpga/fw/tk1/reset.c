@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <tkey/assert.h>
 #include <tkey/debug.h>
+#include <tkey/io.h>
 #include <tkey/lib.h>
 #include <tkey/tk1_mem.h>
 
@@ -52,6 +53,10 @@ int reset(struct user_reset *userreset, size_t nextlen)
 	memcpy((void *)resetinfo->next_app_data, userreset->next_app_data,
 	       nextlen);
 
+	// The UART goes back to the default bit rate on reset. Take
+	// the CH552 with it if an app negotiated another one.
+	(void)uart_set_bit_rate(UART_BIT_RATE_500K);
+
 	// Do the actual reset.
 	*system_reset = 1;
 
@@ -1,24 +1,40 @@
 // SPDX-FileCopyrightText: 2024 Tillitis AB <tillitis.se>
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include "memcheck.h"
 #include "spi.h"
 #include <tkey/assert.h>
+#include <tkey/lib.h>
 #include <tkey/tk1_mem.h>
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+// The burst and DMA registers are there from TK1 version 7. Firmware
+// normally runs on the bitstream it is part of, but not in QEMU.
+#define SPI_BURST_TK1_VERSION 7
+#define SPI_DMA_TK1_VERSION 7
+
 // clang-format off
+static volatile uint32_t *tk1_version =    (volatile uint32_t *)TK1_MMIO_TK1_VERSION;
 static volatile uint32_t *spi_en =         (volatile uint32_t *)(TK1_MMIO_TK1_BASE | 0x200);
 static volatile uint32_t *spi_xfer =       (volatile uint32_t *)(TK1_MMIO_TK1_BASE | 0x204);
 static volatile uint32_t *spi_data =       (volatile uint32_t *)(TK1_MMIO_TK1_BASE | 0x208);
+static volatile uint32_t *spi_burst =      (volatile uint32_t *)(TK1_MMIO_TK1_BASE | 0x20c);
+static volatile uint32_t *spi_dma_dst =    (volatile uint32_t *)(TK1_MMIO_TK1_BASE | 0x210);
+static volatile uint32_t *spi_dma_len =    (volatile uint32_t *)(TK1_MMIO_TK1_BASE | 0x214);
+static volatile uint32_t *spi_mode =       (volatile uint32_t *)(TK1_MMIO_TK1_BASE | 0x218);
 // clang-format on
 
 static int spi_ready(void);
+static bool spi_burst_supported(void);
 static void spi_enable(void);
 static void spi_disable(void);
 static void spi_write(uint8_t *cmd, size_t size);
 static void spi_read(uint8_t *buf, size_t size);
+static void spi_dual(size_t dummy_size);
+static bool spi_dma_valid(uint8_t *dest, size_t size);
 
 // Returns non-zero when the SPI-master is ready, and zero if not
 // ready. This can be used to check if the SPI-master is available
@@ -28,6 +44,12 @@ static int spi_ready(void)
 	return *spi_xfer;
 }
 
+// Returns true if the SPI-master can do four byte bursts.
+static bool spi_burst_supported(void)
+{
+	return *tk1_version >= SPI_BURST_TK1_VERSION;
+}
+
 static void spi_enable(void)
 {
 	*spi_en = 1;
@@ -38,11 +60,24 @@ static void spi_disable(void)
 	*spi_en = 0;
 }
 
+// Writes size bytes. Whole words are sent as four byte bursts, least
+// significant byte first, if supported, the rest byte by byte.
 static void spi_write(uint8_t *cmd, size_t size)
 {
 	assert(cmd != NULL);
 
-	for (size_t i = 0; i < size; i++) {
+	size_t i = 0;
+	bool burst = spi_burst_supported();
+
+	for (; burst && i + 4 <= size; i += 4) {
+		while (!spi_ready()) {
+		}
+
+		*spi_burst = cmd[i] | (cmd[i + 1] << 8) | (cmd[i + 2] << 16) |
+			     ((uint32_t)cmd[i + 3] << 24);
+	}
+
+	for (; i < size; i++) {
 		while (!spi_ready()) {
 		}
 
@@ -54,14 +89,38 @@ static void spi_write(uint8_t *cmd, size_t size)
 	}
 }
 
+// Reads size bytes. Whole words are read in four byte bursts if
+// supported, the rest byte by byte.
 static void spi_read(uint8_t *buf, size_t size)
 {
 	assert(buf != NULL);
 
+	size_t i = 0;
+	bool burst = spi_burst_supported();
+
 	while (!spi_ready()) {
 	}
 
-	for (size_t i = 0; i < size; i++) {
+	for (; burst && i + 4 <= size; i += 4) {
+		*spi_burst = 0x00;
+
+		// wait until spi master is done
+		while (!spi_ready()) {
+		}
+
+		uint32_t word = *spi_burst;
+
+		if (((uintptr_t)&buf[i] & 3) == 0) {
+			*(word_t *)&buf[i] = word;
+		} else {
+			buf[i] = word & 0xff;
+			buf[i + 1] = (word >> 8) & 0xff;
+			buf[i + 2] = (word >> 16) & 0xff;
+			buf[i + 3] = word >> 24;
+		}
+	}
+
+	for (; i < size; i++) {
 
 		*spi_data = 0x00;
 		*spi_xfer = 1;
@@ -74,6 +133,34 @@ static void spi_read(uint8_t *buf, size_t size)
 	}
 }
 
+// Puts the SPI-master in dual mode, releasing MOSI to the memory,
+// and clocks dummy_size dummy bytes, four clocks each. Dual mode is
+// left when the SPI-master is disabled.
+static void spi_dual(size_t dummy_size)
+{
+	while (!spi_ready()) {
+	}
+
+	*spi_mode = 1;
+
+	for (size_t i = 0; i < dummy_size; i++) {
+		*spi_xfer = 1;
+
+		while (!spi_ready()) {
+		}
+	}
+}
+
+// Returns true if the SPI-master can receive two bits per clock.
+bool spi_dual_supported(void)
+{
+	*spi_mode = 1;
+	bool supported = *spi_mode != 0;
+	*spi_mode = 0;
+
+	return supported;
+}
+
 // Function to both read and write data to the connected SPI flash.
 int spi_transfer(uint8_t *cmd, size_t cmd_size, uint8_t *tx_buf, size_t tx_size,
 		 uint8_t *rx_buf, size_t rx_size)
@@ -98,3 +185,101 @@ int spi_transfer(uint8_t *cmd, size_t cmd_size, uint8_t *tx_buf, size_t tx_size,
 
 	return 0;
 }
+
+// Reads from the connected SPI flash with a dual output command. cmd
+// is sent as usual, then the response is read two bits per clock,
+// starting with dummy_size dummy bytes.
+int spi_dual_transfer(uint8_t *cmd, size_t cmd_size, size_t dummy_size,
+		      uint8_t *rx_buf, size_t rx_size)
+{
+	if (cmd == NULL || cmd_size == 0 || rx_buf == NULL) {
+		return -1;
+	}
+
+	spi_enable();
+
+	spi_write(cmd, cmd_size);
+	spi_dual(dummy_size);
+	spi_read(rx_buf, rx_size);
+
+	spi_disable();
+
+	return 0;
+}
+
+// Sends cmd to the connected SPI flash and then lets the SPI DMA read
+// size bytes of the response straight into app RAM at dest. dest must
+// be word aligned and size a multiple of 4.
+//
+// The transfer continues in the background. Follow it with
+// spi_dma_progress() and end it with spi_dma_stop() before doing any
+// other transfers.
+int spi_dma_start(uint8_t *cmd, size_t cmd_size, uint8_t *dest, size_t size)
+{
+	if (cmd == NULL || cmd_size == 0 || !spi_dma_valid(dest, size)) {
+		return -1;
+	}
+
+	spi_enable();
+
+	spi_write(cmd, cmd_size);
+
+	*spi_dma_dst = (uintptr_t)dest - TK1_RAM_BASE;
+	*spi_dma_len = size / 4;
+
+	return 0;
+}
+
+// Like spi_dma_start(), but the response is read two bits per clock,
+// starting with dummy_size dummy bytes, see spi_dual_transfer().
+int spi_dual_dma_start(uint8_t *cmd, size_t cmd_size, size_t dummy_size,
+		       uint8_t *dest, size_t size)
+{
+	if (cmd == NULL || cmd_size == 0 || !spi_dma_valid(dest, size)) {
+		return -1;
+	}
+
+	spi_enable();
+
+	spi_write(cmd, cmd_size);
+	spi_dual(dummy_size);
+
+	*spi_dma_dst = (uintptr_t)dest - TK1_RAM_BASE;
+	*spi_dma_len = size / 4;
+
+	return 0;
+}
+
+// Returns true if the SPI-master has the DMA.
+bool spi_dma_supported(void)
+{
+	return *tk1_version >= SPI_DMA_TK1_VERSION;
+}
+
+// Stops a transfer started by spi_dma_start(), if still running, and
+// releases the SPI flash. Call it also when the transfer is done.
+void spi_dma_stop(void)
+{
+	*spi_dma_len = 0;
+	spi_disable();
+}
+
+// The DMA destination must be word aligned, in app RAM and size a
+// multiple of 4.
+static bool spi_dma_valid(uint8_t *dest, size_t size)
+{
+	if (dest == NULL || size == 0 || size % 4 != 0 ||
+	    (uintptr_t)dest % 4 != 0) {
+		return false;
+	}
+
+	return in_app_ram(dest, size);
+}
+
+// Returns the end of the data the SPI DMA has written to RAM so far.
+// The transfer is done when it reaches the end of the destination.
+// Always finish with spi_dma_stop(), which releases the SPI flash.
+uint8_t *spi_dma_progress(void)
+{
+	return (uint8_t *)(TK1_RAM_BASE + *spi_dma_dst);
+}
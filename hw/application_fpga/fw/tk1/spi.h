@@ -4,10 +4,20 @@
 #ifndef TKEY_SPI_H
 #define TKEY_SPI_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 int spi_transfer(uint8_t *cmd, size_t cmd_size, uint8_t *tx_buf, size_t tx_size,
 		 uint8_t *rx_buf, size_t rx_size);
+int spi_dual_transfer(uint8_t *cmd, size_t cmd_size, size_t dummy_size,
+		      uint8_t *rx_buf, size_t rx_size);
+bool spi_dual_supported(void);
+bool spi_dma_supported(void);
+int spi_dma_start(uint8_t *cmd, size_t cmd_size, uint8_t *dest, size_t size);
+int spi_dual_dma_start(uint8_t *cmd, size_t cmd_size, size_t dummy_size,
+		       uint8_t *dest, size_t size);
+uint8_t *spi_dma_progress(void);
+void spi_dma_stop(void);
 
 #endif
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <tkey/debug.h>
 #include <tkey/lib.h>
+#include <tkey/perf.h>
 #include <tkey/tk1_mem.h>
 
 #include "auth_app.h"
@@ -15,6 +16,29 @@
 #include "partition_table.h"
 #include "storage.h"
 
+// The area the running app has allocated, if any. Looking it up
+// means authenticating against each allocated area, and the CDI
+// can't change while an app is running, so it's only looked up on
+// first use. Kept in FW_RAM, which is cleared on reset.
+static struct {
+	bool valid; // index is looked up
+	int index;  // Index of the app's area, -1 if none
+} area_cache;
+
+// How long storage_erase_wait() lets the flash be busy with one erase
+// operation, in cycles at 24 MHz. A 64 KiB block erase takes at most
+// 1 s according to the W25Q80DL datasheet, this is twice that.
+#define ERASE_OP_TIMEOUT_CYCLES 48000000
+
+// An erase started by storage_erase_start(), carried out one erase
+// operation at a time by storage_erase_poll(). Kept in FW_RAM, which
+// is cleared on reset.
+static struct {
+	bool busy;	  // Erase in progress
+	uint32_t address; // Next address to erase
+	uint32_t end;	  // End of the range to erase
+} erase;
+
 // Returns the index of the first empty area.
 //
 // Returns -1 on errors.
@@ -51,7 +75,7 @@ static int index_to_address(int index, uint32_t *address)
 // Returns the index of the area an app has allocated.
 //
 // Returns -1 on errors.
-static int storage_get_area(struct partition_table *part_table)
+static int storage_lookup_area(struct partition_table *part_table)
 {
 	if (part_table == NULL) {
 		return -1;
@@ -69,6 +93,24 @@ static int storage_get_area(struct partition_table *part_table)
 	return -1;
 }
 
+// Returns the index of the area an app has allocated, looking it up
+// only if it isn't cached.
+//
+// Returns -1 on errors.
+static int storage_get_area(struct partition_table *part_table)
+{
+	if (part_table == NULL) {
+		return -1;
+	}
+
+	if (!area_cache.valid) {
+		area_cache.index = storage_lookup_area(part_table);
+		area_cache.valid = true;
+	}
+
+	return area_cache.index;
+}
+
 // Allocate a new area for an app. Returns zero on success.
 int storage_allocate_area(struct partition_table_storage *part_table_storage)
 {
@@ -106,6 +148,7 @@ int storage_allocate_area(struct partition_table_storage *part_table_storage)
 	// Write partition table lastly
 	part_table->app_storage[index].status = 0x01;
 	auth_app_create(&part_table->app_storage[index].auth);
+	area_cache.index = index;
 
 	if (part_table_write(part_table_storage) != 0) {
 		return -1;
@@ -145,6 +188,7 @@ int storage_deallocate_area(struct partition_table_storage *part_table_storage)
 
 	// Clear partition table lastly
 	part_table->app_storage[index].status = 0;
+	area_cache.index = -1;
 
 	(void)memset(part_table->app_storage[index].auth.nonce, 0x00,
 		     sizeof(part_table->app_storage[index].auth.nonce));
@@ -160,15 +204,15 @@ int storage_deallocate_area(struct partition_table_storage *part_table_storage)
 	return 0;
 }
 
-// Erases sector. Offset of a sector to begin erasing, must be a
-// multiple of the sector size. Size to erase in bytes, must be a
-// multiple of the sector size.
+// Checks that offset and size describe whole sectors within the
+// app's area and returns the flash address of offset in address.
 //
 // Returns zero on success, negative error code on failure
-int storage_erase_sector(struct partition_table *part_table, uint32_t offset,
-			 size_t size)
+static int storage_erase_address(struct partition_table *part_table,
+				 uint32_t offset, size_t size,
+				 uint32_t *address)
 {
-	if (part_table == NULL) {
+	if (part_table == NULL || address == NULL) {
 		return -1;
 	}
 
@@ -201,22 +245,143 @@ int storage_erase_sector(struct partition_table *part_table, uint32_t offset,
 		return -1;
 	}
 
-	uint32_t address = start_address + offset;
+	*address = start_address + offset;
+
+	return 0;
+}
+
+// Starts the largest erase operation that begins at address and
+// doesn't go past end. A block erase takes only a few times longer
+// than a sector erase, so 64 and 32 KiB blocks are used where the
+// address is aligned to one and it fits, sectors otherwise.
+//
+// Returns the number of bytes being erased.
+static uint32_t storage_erase_next(uint32_t address, uint32_t end)
+{
+	if (address % BLOCK_64_SIZE == 0 && end - address >= BLOCK_64_SIZE) {
+		flash_block_64_erase_start(address);
+		return BLOCK_64_SIZE;
+	}
+
+	if (address % BLOCK_32_SIZE == 0 && end - address >= BLOCK_32_SIZE) {
+		flash_block_32_erase_start(address);
+		return BLOCK_32_SIZE;
+	}
+
+	flash_sector_erase_start(address);
+	return SECTOR_SIZE;
+}
+
+// Erases sector. Offset of a sector to begin erasing, must be a
+// multiple of the sector size. Size to erase in bytes, must be a
+// multiple of the sector size. Erases whole blocks at once where
+// possible.
+//
+// Returns zero on success, negative error code on failure
+int storage_erase_sector(struct partition_table *part_table, uint32_t offset,
+			 size_t size)
+{
+	uint32_t address = 0;
+
+	if (storage_erase_address(part_table, offset, size, &address) != 0) {
+		return -1;
+	}
 
 	debug_puts("storage: erase addr: ");
 	debug_putinthex(address);
 	debug_lf();
 
-	for (size_t i = 0; i < size; i += 4096) {
-		flash_sector_erase(address);
-		address += 4096;
+	uint32_t end = address + size;
+
+	while (address < end) {
+		address += storage_erase_next(address, end);
+		flash_wait_busy();
+	}
+
+	return 0;
+}
+
+// Starts erasing sectors like storage_erase_sector() but returns as
+// soon as the first erase operation is started. The rest is done by
+// storage_erase_poll(), which must return 0 before the flash is used
+// for anything else.
+//
+// Returns zero on success, negative error code on failure
+int storage_erase_start(struct partition_table *part_table, uint32_t offset,
+			size_t size)
+{
+	uint32_t address = 0;
+
+	if (erase.busy) {
+		return -1;
+	}
+
+	if (storage_erase_address(part_table, offset, size, &address) != 0) {
+		return -1;
+	}
+
+	debug_puts("storage: start erase addr: ");
+	debug_putinthex(address);
+	debug_lf();
+
+	erase.busy = true;
+	erase.end = address + size;
+	erase.address = address + storage_erase_next(address, erase.end);
+
+	return 0;
+}
+
+// Continues an erase started by storage_erase_start(), starting the
+// next erase operation if the flash is done with the previous one.
+//
+// Returns 1 while erasing, 0 when done or if no erase was started.
+int storage_erase_poll(void)
+{
+	if (!erase.busy) {
+		return 0;
+	}
+
+	if (flash_is_busy()) {
+		return 1;
+	}
+
+	if (erase.address < erase.end) {
+		erase.address += storage_erase_next(erase.address, erase.end);
+
+		return 1;
+	}
+
+	erase.busy = false;
+
+	return 0;
+}
+
+// Blocks until an erase started by storage_erase_start() is done, but
+// gives up if the flash stays busy with one erase operation for longer
+// than ERASE_OP_TIMEOUT_CYCLES. The erase is then still in progress.
+//
+// Returns 0 when done, -1 on timeout.
+int storage_erase_wait(void)
+{
+	uint32_t address = erase.address;
+	uint32_t start = perf_cycles();
+
+	while (storage_erase_poll() != 0) {
+		if (erase.address != address) {
+			// Next erase operation started
+			address = erase.address;
+			start = perf_cycles();
+		} else if (perf_cycles() - start > ERASE_OP_TIMEOUT_CYCLES) {
+			return -1;
+		}
 	}
 
 	return 0;
 }
 
 // Writes the specified data to the offset inside of the allocated area.
-// Assumes area has been erased before hand. Offset must be a multiple of 256.
+// Assumes area has been erased before hand. Offset and size can be
+// anything within the area.
 //
 // Returns zero on success.
 int storage_write_data(struct partition_table *part_table, uint32_t offset,
@@ -264,7 +429,7 @@ int storage_write_data(struct partition_table *part_table, uint32_t offset,
 }
 
 // Reads size bytes of data at the specified offset inside of the
-// allocated area.
+// allocated area, in one continuous read from flash.
 //
 // Only read limit is the size of the allocated area.
 //
@@ -296,7 +461,7 @@ int storage_read_data(struct partition_table *part_table, uint32_t offset,
 		return -1;
 	}
 
-	if (size > 4096) {
+	if (size > SIZE_STORAGE_AREA) {
 		return -1;
 	}
 
@@ -314,6 +479,37 @@ int storage_read_data(struct partition_table *part_table, uint32_t offset,
 	return flash_read_data(address, data, size);
 }
 
+// Reads count pieces of the allocated area described by vec, each
+// with the same limits as storage_read_data(). Stops at the first
+// piece that can't be read.
+//
+// Returns zero on success.
+int storage_read_data_vec(struct partition_table *part_table,
+			  struct read_vec *vec, size_t count)
+{
+	if (part_table == NULL || vec == NULL) {
+		return -1;
+	}
+
+	if (count > TK1_RAM_SIZE / sizeof(*vec) ||
+	    !in_app_ram(vec, count * sizeof(*vec))) {
+		return -1;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		// Copy the piece first, since a read might overwrite
+		// vec.
+		struct read_vec piece = vec[i];
+
+		if (storage_read_data(part_table, piece.offset, piece.buf,
+				      piece.len) != 0) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
 // Erases all app storage. Privileged operation. Returns zero on
 // success.
 int storage_erase_areas(struct partition_table_storage *part_table_storage)
@@ -323,6 +519,8 @@ int storage_erase_areas(struct partition_table_storage *part_table_storage)
 		return -1;
 	}
 
+	area_cache.valid = false;
+
 	for (uint8_t i = 0; i < N_STORAGE_AREA; i++) {
 		struct app_storage_area *app_storage =
 		    &part_table_storage->table.app_storage[i];
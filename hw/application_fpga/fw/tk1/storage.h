@@ -10,14 +10,29 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// A piece of the app's storage area to read with
+// storage_read_data_vec(). Needs to be held synchronized with
+// tkey-libs.
+struct read_vec {
+	uint32_t offset; // Offset in the area
+	uint8_t *buf;	 // Where to read to
+	uint32_t len;	 // Bytes to read
+};
+
 int storage_deallocate_area(struct partition_table_storage *part_table_storage);
 int storage_allocate_area(struct partition_table_storage *part_table_storage);
 int storage_erase_sector(struct partition_table *part_table, uint32_t offset,
 			 size_t size);
+int storage_erase_start(struct partition_table *part_table, uint32_t offset,
+			size_t size);
+int storage_erase_poll(void);
+int storage_erase_wait(void);
 int storage_write_data(struct partition_table *part_table, uint32_t offset,
 		       uint8_t *data, size_t size);
 int storage_read_data(struct partition_table *part_table, uint32_t offset,
 		      uint8_t *data, size_t size);
+int storage_read_data_vec(struct partition_table *part_table,
+			  struct read_vec *vec, size_t count);
 int storage_erase_areas(struct partition_table_storage *part_table_storage);
 
 #endif
@@ -1,12 +1,14 @@
 // SPDX-FileCopyrightText: 2025 Tillitis AB <tillitis.se>
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <tkey/assert.h>
 #include <tkey/debug.h>
 #include <tkey/lib.h>
 #include <tkey/tk1_mem.h>
 
+#include "boot_times.h"
 #include "partition_table.h"
 #include "preload_app.h"
 #include "reset.h"
@@ -20,9 +22,43 @@ static volatile uint32_t *udi           = (volatile uint32_t *)TK1_MMIO_TK1_UDI_
 extern struct partition_table_storage part_table_storage;
 extern uint8_t part_status;
 
+// Returns true for system calls that use the flash. RESET counts,
+// since firmware reads the flash when starting again.
+static bool uses_flash(uint32_t number)
+{
+	switch (number) {
+	case TK1_SYSCALL_RESET:
+	case TK1_SYSCALL_ALLOC_AREA:
+	case TK1_SYSCALL_DEALLOC_AREA:
+	case TK1_SYSCALL_WRITE_DATA:
+	case TK1_SYSCALL_READ_DATA:
+	case TK1_SYSCALL_READ_DATA_VEC:
+	case TK1_SYSCALL_ERASE_DATA:
+	case TK1_SYSCALL_ERASE_DATA_START:
+	case TK1_SYSCALL_PRELOAD_DELETE:
+	case TK1_SYSCALL_PRELOAD_STORE:
+	case TK1_SYSCALL_PRELOAD_STORE_FIN:
+	case TK1_SYSCALL_PRELOAD_SET_PUBKEY:
+	case TK1_SYSCALL_ERASE_AREAS:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
 int32_t syscall_handler(uint32_t number, uint32_t arg1, uint32_t arg2,
 			uint32_t arg3)
 {
+	// The flash can't be used while an erase started by
+	// ERASE_DATA_START is running, so finish it first.
+	if (uses_flash(number)) {
+		if (storage_erase_wait() != 0) {
+			debug_puts("flash erase timed out\n");
+			return -1;
+		}
+	}
+
 	switch (number) {
 	case TK1_SYSCALL_RESET:
 		return reset((struct user_reset *)arg1, (size_t)arg2);
@@ -58,6 +94,17 @@ int32_t syscall_handler(uint32_t number, uint32_t arg1, uint32_t arg2,
 		}
 		return 0;
 
+	case TK1_SYSCALL_READ_DATA_VEC:
+		// arg1 vec
+		// arg2 count
+		if (storage_read_data_vec(&part_table_storage.table,
+					  (struct read_vec *)arg1,
+					  arg2) < 0) {
+			debug_puts("couldn't read storage area\n");
+			return -1;
+		}
+		return 0;
+
 	case TK1_SYSCALL_ERASE_DATA:
 		if (storage_erase_sector(&part_table_storage.table, arg1,
 					 arg2) < 0) {
@@ -66,6 +113,19 @@ int32_t syscall_handler(uint32_t number, uint32_t arg1, uint32_t arg2,
 		}
 		return 0;
 
+	case TK1_SYSCALL_ERASE_DATA_START:
+		// arg1 offset
+		// arg2 size
+		if (storage_erase_start(&part_table_storage.table, arg1,
+					arg2) < 0) {
+			debug_puts("couldn't start erasing storage area\n");
+			return -1;
+		}
+		return 0;
+
+	case TK1_SYSCALL_ERASE_DATA_STATUS:
+		return storage_erase_poll();
+
 	case TK1_SYSCALL_GET_VIDPID:
 		// UDI is 2 words: VID/PID & serial. Return just the
 		// first word. Serial is kept secret to the device
@@ -113,6 +173,10 @@ int32_t syscall_handler(uint32_t number, uint32_t arg1, uint32_t arg2,
 	case TK1_SYSCALL_ERASE_AREAS:
 		return storage_erase_areas(&part_table_storage);
 
+	case TK1_SYSCALL_GET_BOOT_TIMES:
+		// arg1 boot_times
+		return boot_times_get((struct boot_times *)arg1);
+
 	default:
 		assert(1 == 2);
 	}
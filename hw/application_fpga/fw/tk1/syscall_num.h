@@ -21,6 +21,10 @@ enum syscall_num {
 	TK1_SYSCALL_GET_APP_DATA = 14,
 	TK1_SYSCALL_PRELOAD_SET_PUBKEY = 15,
 	TK1_SYSCALL_ERASE_AREAS = 16,
+	TK1_SYSCALL_GET_BOOT_TIMES = 17,
+	TK1_SYSCALL_READ_DATA_VEC = 18,
+	TK1_SYSCALL_ERASE_DATA_START = 19,
+	TK1_SYSCALL_ERASE_DATA_STATUS = 20,
 };
 
 #endif
@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+// Host unit test of the word-wise memset(), memcpy(), memeq() and
+// secure_wipe() in tkey-libs. They are renamed here so the host's
+// own are still used by everything else. Every combination of
+// source and destination alignment and lengths up to LEN_MAX is
+// checked against a byte-wise reference, including that nothing
+// outside the range is written.
+
+#define memset lib_memset
+#define memcpy lib_memcpy
+#define memcpy_s lib_memcpy_s
+#define wordcpy lib_wordcpy
+#define wordcpy_s lib_wordcpy_s
+#define memeq lib_memeq
+#define secure_wipe lib_secure_wipe
+#define strlen lib_strlen
+
+#include "../../../tkey-libs/libcommon/lib.c"
+
+int printf(const char *format, ...);
+
+#define LEN_MAX 48
+#define GUARD 8
+#define BUF_SIZE (GUARD + 4 + LEN_MAX + GUARD)
+
+static uint32_t src_words[BUF_SIZE / 4 + 1];
+static uint32_t dst_words[BUF_SIZE / 4 + 1];
+static int failed;
+
+void assert_halt(void)
+{
+	printf("FAIL assert\n");
+	failed = 1;
+}
+
+// Fills buf with a pattern that differs for every byte and seed.
+static void fill(uint8_t *buf, uint8_t seed)
+{
+	for (int i = 0; i < BUF_SIZE; i++) {
+		buf[i] = (uint8_t)(i * 37 + seed);
+	}
+}
+
+// Byte-wise reference copy.
+static void copy_ref(uint8_t *dst, const uint8_t *src, int n)
+{
+	for (int i = 0; i < n; i++) {
+		dst[i] = src[i];
+	}
+}
+
+static void check_memcpy(void)
+{
+	uint8_t *src = (uint8_t *)src_words;
+	uint8_t *dst = (uint8_t *)dst_words;
+
+	for (int so = 0; so < 4; so++) {
+		for (int doff = 0; doff < 4; doff++) {
+			for (int n = 0; n <= LEN_MAX; n++) {
+				fill(src, 1);
+				fill(dst, 2);
+				lib_memcpy(dst + GUARD + doff, src + GUARD + so, n);
+
+				for (int i = 0; i < BUF_SIZE; i++) {
+					int off = i - GUARD - doff;
+					uint8_t want = off >= 0 && off < n
+							   ? src[GUARD + so + off]
+							   : (uint8_t)(i * 37 + 2);
+
+					if (dst[i] != want) {
+						printf("FAIL memcpy src +%d dst +%d"
+						       " %d bytes at %d\n",
+						       so, doff, n, i);
+						failed = 1;
+						return;
+					}
+				}
+			}
+		}
+	}
+
+	printf("ok   memcpy\n");
+}
+
+static void check_memset(void)
+{
+	uint8_t *dst = (uint8_t *)dst_words;
+
+	for (int doff = 0; doff < 4; doff++) {
+		for (int n = 0; n <= LEN_MAX; n++) {
+			fill(dst, 2);
+			lib_memset(dst + GUARD + doff, 0x1a5, n);
+
+			for (int i = 0; i < BUF_SIZE; i++) {
+				int off = i - GUARD - doff;
+				uint8_t want = off >= 0 && off < n
+						   ? 0xa5
+						   : (uint8_t)(i * 37 + 2);
+
+				if (dst[i] != want) {
+					printf("FAIL memset +%d %d bytes at %d\n",
+					       doff, n, i);
+					failed = 1;
+					return;
+				}
+			}
+		}
+	}
+
+	printf("ok   memset\n");
+}
+
+static void check_secure_wipe(void)
+{
+	uint8_t *dst = (uint8_t *)dst_words;
+
+	for (int doff = 0; doff < 4; doff++) {
+		for (int n = 0; n <= LEN_MAX; n++) {
+			fill(dst, 2);
+			lib_secure_wipe(dst + GUARD + doff, n);
+
+			for (int i = 0; i < BUF_SIZE; i++) {
+				int off = i - GUARD - doff;
+				uint8_t want = off >= 0 && off < n
+						   ? 0
+						   : (uint8_t)(i * 37 + 2);
+
+				if (dst[i] != want) {
+					printf("FAIL secure_wipe +%d %d bytes"
+					       " at %d\n",
+					       doff, n, i);
+					failed = 1;
+					return;
+				}
+			}
+		}
+	}
+
+	printf("ok   secure_wipe\n");
+}
+
+// Checks that equal ranges compare equal, and that a difference in
+// any byte, and only within the range, makes them unequal.
+static void check_memeq(void)
+{
+	uint8_t *a = (uint8_t *)src_words;
+	uint8_t *b = (uint8_t *)dst_words;
+
+	for (int ao = 0; ao < 4; ao++) {
+		for (int bo = 0; bo < 4; bo++) {
+			for (int n = 0; n <= LEN_MAX; n++) {
+				uint8_t *pa = a + GUARD + ao;
+				uint8_t *pb = b + GUARD + bo;
+
+				fill(a, 1);
+				fill(b, 2);
+				copy_ref(pb, pa, n);
+
+				if (!lib_memeq(pb, pa, n)) {
+					printf("FAIL memeq +%d +%d %d bytes"
+					       " equal\n",
+					       ao, bo, n);
+					failed = 1;
+					return;
+				}
+
+				for (int i = 0; i < n; i++) {
+					pb[i] ^= 0x10;
+
+					if (lib_memeq(pb, pa, n)) {
+						printf("FAIL memeq +%d +%d %d"
+						       " bytes differ at %d\n",
+						       ao, bo, n, i);
+						failed = 1;
+						return;
+					}
+
+					pb[i] ^= 0x10;
+				}
+			}
+		}
+	}
+
+	printf("ok   memeq\n");
+}
+
+int main(void)
+{
+	check_memcpy();
+	check_memset();
+	check_secure_wipe();
+	check_memeq();
+
+	return failed;
+}
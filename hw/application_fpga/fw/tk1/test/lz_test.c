@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+// Host unit test of the LZ4 decoder in lz.c. Decompresses a
+// compressed app, made by tools/compress_app.py, the way the
+// firmware does when it is sent from the client: in 127 byte chunks
+// with the header in the first one. Checks that the result is the
+// original app and reports how many FW_CMD_LOAD_APP_DATA commands
+// are needed with and without compression.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../lz.h"
+
+#define APP_MAX_SIZE 0x20000
+#define CHUNK_SIZE 127
+
+static uint8_t app[APP_MAX_SIZE];
+static uint8_t compressed[APP_MAX_SIZE + 1024];
+static uint8_t out[APP_MAX_SIZE];
+
+static size_t read_file(const char *name, uint8_t *buf, size_t size)
+{
+	FILE *f = fopen(name, "rb");
+
+	if (f == NULL) {
+		perror(name);
+		exit(1);
+	}
+
+	size_t n = fread(buf, 1, size, f);
+	fclose(f);
+
+	return n;
+}
+
+int main(int argc, char *argv[])
+{
+	struct lz lz;
+
+	if (argc != 3) {
+		fprintf(stderr, "Usage: %s app.bin app.lz\n", argv[0]);
+		return 1;
+	}
+
+	size_t app_size = read_file(argv[1], app, sizeof(app));
+	size_t size = read_file(argv[2], compressed, sizeof(compressed));
+
+	uint32_t out_size = lz_header(compressed, size);
+	if (out_size != app_size) {
+		printf("FAIL header says %u bytes, app is %zu\n", out_size,
+		       app_size);
+		return 1;
+	}
+
+	lz_init(&lz, out, out_size);
+
+	for (size_t i = 0; i < size; i += CHUNK_SIZE) {
+		size_t n = size - i < CHUNK_SIZE ? size - i : CHUNK_SIZE;
+		size_t skip = i == 0 ? LZ_HEADER_SIZE : 0;
+
+		if (lz_decode(&lz, compressed + i + skip, n - skip) != 0) {
+			printf("FAIL decoding chunk at %zu\n", i);
+			return 1;
+		}
+	}
+
+	if (!lz_done(&lz) || memcmp(out, app, app_size) != 0) {
+		printf("FAIL %s doesn't decompress to %s\n", argv[2], argv[1]);
+		return 1;
+	}
+
+	printf("ok   %s: %zu -> %zu bytes, %zu -> %zu load commands\n",
+	       argv[1], app_size, size,
+	       (app_size + CHUNK_SIZE - 1) / CHUNK_SIZE,
+	       (size + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+	return 0;
+}
@@ -0,0 +1,439 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+// Host unit test of how storage.c splits an erase into sector, 32 KiB
+// block and 64 KiB block erases. storage.c is built in here with the
+// flash driver replaced by stubs that record the erase operations.
+// The time the erase operations take is estimated from the W25Q80DL
+// datasheet.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Replaces tkey/perf.h, which reads the cycle counter of the TKey CPU.
+// Each read of the counter here advances it.
+#define TKEY_PERF_H
+
+static uint32_t cycles;
+static uint32_t cycles_per_read;
+
+static inline uint32_t perf_cycles(void)
+{
+	cycles += cycles_per_read;
+
+	return cycles;
+}
+
+#include "../storage.c"
+
+int printf(const char *format, ...);
+
+#define MAX_OPS 64
+
+// Erase times in ms from the W25Q80DL datasheet, typical and max.
+#define T_SE_TYP 45
+#define T_SE_MAX 400
+#define T_BE1_TYP 120
+#define T_BE1_MAX 800
+#define T_BE2_TYP 150
+#define T_BE2_MAX 1000
+
+struct erase_op {
+	uint32_t address;
+	uint32_t size;
+};
+
+static struct erase_op ops[MAX_OPS];
+static int nops;
+static int failed;
+static int busy_polls; // Polls flash_is_busy() answers true to
+
+static void record(uint32_t address, uint32_t size)
+{
+	if (nops < MAX_OPS) {
+		ops[nops].address = address;
+		ops[nops].size = size;
+	}
+
+	nops++;
+}
+
+void flash_sector_erase_start(uint32_t address)
+{
+	record(address, SECTOR_SIZE);
+}
+
+void flash_block_32_erase_start(uint32_t address)
+{
+	record(address, BLOCK_32_SIZE);
+}
+
+void flash_block_64_erase_start(uint32_t address)
+{
+	record(address, BLOCK_64_SIZE);
+}
+
+// Not used by the erase planning, but referred to by storage.c.
+
+void flash_block_64_erase(uint32_t address)
+{
+	(void)address;
+}
+
+void flash_wait_busy(void)
+{
+}
+
+bool flash_is_busy(void)
+{
+	if (busy_polls > 0) {
+		busy_polls--;
+		return true;
+	}
+
+	return false;
+}
+
+int flash_read_data(uint32_t address, uint8_t *dest_buf, size_t size)
+{
+	(void)address;
+	(void)dest_buf;
+	(void)size;
+
+	return 0;
+}
+
+int flash_write_data(uint32_t address, uint8_t *data, size_t size)
+{
+	(void)address;
+	(void)data;
+	(void)size;
+
+	return 0;
+}
+
+int part_table_write(struct partition_table_storage *storage)
+{
+	(void)storage;
+
+	return 0;
+}
+
+void auth_app_create(struct auth_metadata *metadata)
+{
+	(void)metadata;
+}
+
+bool auth_app_authenticate(struct auth_metadata *metadata)
+{
+	(void)metadata;
+
+	return false;
+}
+
+bool mgmt_app_authenticate(void)
+{
+	return false;
+}
+
+bool in_app_ram(const void *addr, size_t size)
+{
+	(void)addr;
+	(void)size;
+
+	return true;
+}
+
+// Returns the typical, or with max set the maximum, time in ms of an
+// erase operation of size bytes.
+static uint32_t erase_time(uint32_t size, bool max)
+{
+	switch (size) {
+	case BLOCK_64_SIZE:
+		return max ? T_BE2_MAX : T_BE2_TYP;
+
+	case BLOCK_32_SIZE:
+		return max ? T_BE1_MAX : T_BE1_TYP;
+
+	default:
+		return max ? T_SE_MAX : T_SE_TYP;
+	}
+}
+
+// Returns the time in ms of the erase operations recorded.
+static uint32_t ops_time(bool max)
+{
+	uint32_t t = 0;
+
+	for (int i = 0; i < nops && i < MAX_OPS; i++) {
+		t += erase_time(ops[i].size, max);
+	}
+
+	return t;
+}
+
+// Plans the erase of size bytes from address the way
+// storage_erase_sector() does and checks that it is made of the
+// erase operations in want.
+static void check(const char *name, uint32_t address, uint32_t size,
+		  const struct erase_op *want, int nwant)
+{
+	uint32_t end = address + size;
+	int ok = 1;
+
+	nops = 0;
+
+	while (address < end && nops < MAX_OPS) {
+		address += storage_erase_next(address, end);
+	}
+
+	if (nops != nwant) {
+		ok = 0;
+	}
+
+	for (int i = 0; ok && i < nops; i++) {
+		if (ops[i].address != want[i].address ||
+		    ops[i].size != want[i].size) {
+			ok = 0;
+		}
+	}
+
+	if (ok) {
+		printf("ok   %s\n", name);
+		return;
+	}
+
+	printf("FAIL %s\n", name);
+	for (int i = 0; i < nops && i < MAX_OPS; i++) {
+		printf("     got  0x%06x 0x%05x\n", ops[i].address,
+		       ops[i].size);
+	}
+	for (int i = 0; i < nwant; i++) {
+		printf("     want 0x%06x 0x%05x\n", want[i].address,
+		       want[i].size);
+	}
+
+	failed = 1;
+}
+
+// Checks every sector aligned range in the first 256 KiB: the erases
+// must follow each other without gaps, each one must be aligned to
+// its own size and none may go past the end of the range. Each one
+// must also be the largest that is aligned and fits, and the whole
+// erase must never take longer than erasing sector by sector.
+static void check_all_ranges(void)
+{
+	const uint32_t limit = 0x40000;
+	const uint32_t blocks[2] = {BLOCK_64_SIZE, BLOCK_32_SIZE};
+	int ok = 1;
+
+	for (uint32_t start = 0; ok && start < limit; start += SECTOR_SIZE) {
+		for (uint32_t end = start + SECTOR_SIZE; ok && end <= limit;
+		     end += SECTOR_SIZE) {
+			uint32_t address = start;
+
+			nops = 0;
+
+			while (address < end && nops < MAX_OPS) {
+				uint32_t n = storage_erase_next(address, end);
+
+				if (ops[nops - 1].address != address ||
+				    ops[nops - 1].size != n ||
+				    address % n != 0 || end - address < n) {
+					printf("FAIL all ranges: 0x%06x..0x%06x"
+					       " at 0x%06x\n",
+					       start, end, address);
+					ok = 0;
+					break;
+				}
+
+				for (int i = 0; i < 2; i++) {
+					uint32_t block = blocks[i];
+
+					if (block > n && address % block == 0 &&
+					    end - address >= block) {
+						printf("FAIL all ranges: 0x%06x..0x%06x"
+						       " 0x%05x at 0x%06x fits\n",
+						       start, end, block, address);
+						ok = 0;
+					}
+				}
+
+				address += n;
+			}
+
+			uint32_t sectors = (end - start) / SECTOR_SIZE;
+
+			if (ok && (address != end ||
+				   ops_time(false) > sectors * T_SE_TYP ||
+				   ops_time(true) > sectors * T_SE_MAX)) {
+				printf("FAIL all ranges: 0x%06x..0x%06x\n",
+				       start, end);
+				ok = 0;
+			}
+		}
+	}
+
+	if (ok) {
+		printf("ok   all ranges\n");
+	} else {
+		failed = 1;
+	}
+}
+
+// Checks that erasing each whole storage area and app slot is two
+// 64 KiB block erases, compared to 32 sector erases before.
+static void check_areas(void)
+{
+	uint32_t areas[N_STORAGE_AREA + N_PRELOADED_APP];
+	int n = 0;
+
+	for (int i = 0; i < N_PRELOADED_APP; i++) {
+		areas[n++] = ADDR_PRE_LOADED_APP_0 + i * SIZE_PRE_LOADED_APP;
+	}
+
+	for (int i = 0; i < N_STORAGE_AREA; i++) {
+		areas[n++] = ADDR_STORAGE_AREA + i * SIZE_STORAGE_AREA;
+	}
+
+	for (int i = 0; i < n; i++) {
+		uint32_t address = areas[i];
+		uint32_t end = address + SIZE_STORAGE_AREA;
+
+		nops = 0;
+
+		while (address < end && nops < MAX_OPS) {
+			address += storage_erase_next(address, end);
+		}
+
+		if (nops != 2 || ops[0].size != BLOCK_64_SIZE ||
+		    ops[1].size != BLOCK_64_SIZE) {
+			printf("FAIL area at 0x%06x: %d erases\n", areas[i],
+			       nops);
+			failed = 1;
+			return;
+		}
+	}
+
+	uint32_t sectors = SIZE_STORAGE_AREA / SECTOR_SIZE;
+
+	printf("ok   whole areas: %d erases, %u ms typ, %u ms max\n", nops,
+	       ops_time(false), ops_time(true));
+	printf("     by sector:   %u erases, %u ms typ, %u ms max\n",
+	       sectors, sectors * T_SE_TYP, sectors * T_SE_MAX);
+}
+
+// Checks that storage_erase_wait() waits for an erase operation that
+// takes up to ERASE_OP_TIMEOUT_CYCLES, but gives up on one that takes
+// longer and leaves the erase in progress.
+static void check_erase_wait(void)
+{
+	cycles_per_read = 1000;
+	nops = 0;
+
+	// Two operations left, each busy just below the timeout
+	erase.busy = true;
+	erase.address = 0x40000;
+	erase.end = 0x60000;
+	busy_polls = ERASE_OP_TIMEOUT_CYCLES / 1000 - 1;
+
+	if (storage_erase_wait() != 0 || erase.busy || nops != 2) {
+		printf("FAIL erase wait\n");
+		failed = 1;
+		return;
+	}
+
+	// Stuck busy
+	erase.busy = true;
+	erase.address = 0x60000;
+	busy_polls = ERASE_OP_TIMEOUT_CYCLES / 1000 + 2;
+
+	if (storage_erase_wait() != -1 || !erase.busy) {
+		printf("FAIL erase wait timeout\n");
+		failed = 1;
+		return;
+	}
+
+	busy_polls = 0;
+	erase.busy = false;
+
+	printf("ok   erase wait\n");
+}
+
+int main(void)
+{
+	const struct erase_op one_sector[] = {
+	    {0x20000, SECTOR_SIZE},
+	};
+	check("one sector", 0x20000, SECTOR_SIZE, one_sector, 1);
+
+	const struct erase_op block_32[] = {
+	    {0x28000, BLOCK_32_SIZE},
+	};
+	check("32 KiB block", 0x28000, BLOCK_32_SIZE, block_32, 1);
+
+	const struct erase_op block_64[] = {
+	    {0x30000, BLOCK_64_SIZE},
+	};
+	check("64 KiB block", 0x30000, BLOCK_64_SIZE, block_64, 1);
+
+	// A storage area, 128 KiB aligned to 64 KiB
+	const struct erase_op area[] = {
+	    {0x40000, BLOCK_64_SIZE},
+	    {0x50000, BLOCK_64_SIZE},
+	};
+	check("whole area", 0x40000, 0x20000, area, 2);
+
+	// 64 KiB aligned, but too short for a 64 KiB block
+	const struct erase_op short_64[] = {
+	    {0x20000, BLOCK_32_SIZE},
+	    {0x28000, SECTOR_SIZE},
+	    {0x29000, SECTOR_SIZE},
+	    {0x2a000, SECTOR_SIZE},
+	};
+	check("64 KiB aligned, 44 KiB", 0x20000, 0xb000, short_64, 4);
+
+	// 32 KiB aligned but not 64 KiB aligned, 64 KiB long
+	const struct erase_op odd_32[] = {
+	    {0x28000, BLOCK_32_SIZE},
+	    {0x30000, BLOCK_32_SIZE},
+	};
+	check("32 KiB aligned, 64 KiB", 0x28000, BLOCK_64_SIZE, odd_32, 2);
+
+	// Sectors up to a 64 KiB boundary, a block, a sector after
+	const struct erase_op unaligned[] = {
+	    {0x2e000, SECTOR_SIZE},
+	    {0x2f000, SECTOR_SIZE},
+	    {0x30000, BLOCK_64_SIZE},
+	    {0x40000, SECTOR_SIZE},
+	};
+	check("unaligned start", 0x2e000, 0x13000, unaligned, 4);
+
+	// Sectors up to a 32 KiB boundary, then a 32 KiB block
+	const struct erase_op up_to_32[] = {
+	    {0x27000, SECTOR_SIZE},
+	    {0x28000, BLOCK_32_SIZE},
+	};
+	check("sector then 32 KiB block", 0x27000, 0x9000, up_to_32, 2);
+
+	// One sector short of a 64 KiB block from an aligned address
+	const struct erase_op short_sector[] = {
+	    {0x30000, BLOCK_32_SIZE}, {0x38000, SECTOR_SIZE},
+	    {0x39000, SECTOR_SIZE},   {0x3a000, SECTOR_SIZE},
+	    {0x3b000, SECTOR_SIZE},   {0x3c000, SECTOR_SIZE},
+	    {0x3d000, SECTOR_SIZE},   {0x3e000, SECTOR_SIZE},
+	};
+	check("64 KiB minus a sector", 0x30000, 0xf000, short_sector, 8);
+
+	// Last sector of the flash
+	const struct erase_op last[] = {
+	    {0xfff000, SECTOR_SIZE},
+	};
+	check("last sector", 0xfff000, SECTOR_SIZE, last, 1);
+
+	check_all_ranges();
+	check_areas();
+	check_erase_wait();
+
+	return failed;
+}
@@ -25,7 +25,7 @@ module application_fpga (
 
     output wire spi_ss,
     output wire spi_sck,
-    output wire spi_mosi,
+    inout  wire spi_mosi,
     input  wire spi_miso,
 
     input wire touch_event,
@@ -56,6 +56,9 @@ module application_fpga (
   localparam UDS_PREFIX = 6'h02;
   localparam UART_PREFIX = 6'h03;
   localparam TOUCH_SENSE_PREFIX = 6'h04;
+  localparam BLAKE2S_PREFIX = 6'h05;
+  localparam SHA512_PREFIX = 6'h06;
+  localparam FE25519_PREFIX = 6'h07;
   localparam FW_RAM_PREFIX = 6'h10;
   localparam SYSCALL_PREFIX = 6'h21;
   localparam TK1_PREFIX = 6'h3f;
@@ -143,6 +146,31 @@ module application_fpga (
   wire [31 : 0] touch_sense_read_data;
   wire          touch_sense_ready;
 
+  reg           blake2s_cs;
+  reg           blake2s_we;
+  reg  [ 7 : 0] blake2s_address;
+  reg  [31 : 0] blake2s_write_data;
+  wire [31 : 0] blake2s_read_data;
+  wire          blake2s_ready;
+  wire          blake2s_ram_req;
+  wire [14 : 0] blake2s_ram_address;
+  reg           blake2s_ram_ack;
+  reg           blake2s_ram_ack_reg;
+
+  reg           sha512_cs;
+  reg           sha512_we;
+  reg  [ 7 : 0] sha512_address;
+  reg  [31 : 0] sha512_write_data;
+  wire [31 : 0] sha512_read_data;
+  wire          sha512_ready;
+
+  reg           fe25519_cs;
+  reg           fe25519_we;
+  reg  [ 7 : 0] fe25519_address;
+  reg  [31 : 0] fe25519_write_data;
+  wire [31 : 0] fe25519_read_data;
+  wire          fe25519_ready;
+
   reg           irq31_cs;
   reg           irq31_we;
   reg           irq31_eoi;
@@ -158,6 +186,19 @@ module application_fpga (
   wire          force_trap;
   wire [14 : 0] ram_addr_rand;
   wire [31 : 0] ram_data_rand;
+  wire [31 : 0] ram_fill_data;
+  wire          ram_fill_state_we;
+  wire          ram_fill_acc_we;
+  wire          ram_fill_start;
+  wire          ram_fill_busy;
+  wire          spi_dma_ram_req;
+  wire [14 : 0] spi_dma_ram_address;
+  wire [31 : 0] spi_dma_ram_write_data;
+  reg           spi_dma_ram_ack;
+  reg           spi_dma_ram_ack_reg;
+  wire          spi_mosi_out;
+  wire          spi_mosi_en;
+  wire          spi_io0;
   wire          tk1_system_reset;
   /* verilator lint_on UNOPTFLAT */
 
@@ -175,17 +216,18 @@ module application_fpga (
 
 
   picorv32 #(
-      .ENABLE_COUNTERS (0),
-      .TWO_STAGE_SHIFT (0),
-      .CATCH_MISALIGN  (0),
-      .COMPRESSED_ISA  (1),
-      .ENABLE_FAST_MUL (1),
-      .BARREL_SHIFTER  (1),
-      .ENABLE_IRQ      (1),
-      .ENABLE_IRQ_QREGS(0),
-      .ENABLE_IRQ_TIMER(0),
-      .MASKED_IRQ      (~IRQ31_IRQ_MASK),
-      .LATCHED_IRQ     (IRQ31_IRQ_MASK)
+      .ENABLE_COUNTERS  (1),
+      .ENABLE_COUNTERS64(1),
+      .TWO_STAGE_SHIFT  (0),
+      .CATCH_MISALIGN   (0),
+      .COMPRESSED_ISA   (1),
+      .ENABLE_FAST_MUL  (1),
+      .BARREL_SHIFTER   (1),
+      .ENABLE_IRQ       (1),
+      .ENABLE_IRQ_QREGS (0),
+      .ENABLE_IRQ_TIMER (0),
+      .MASKED_IRQ       (~IRQ31_IRQ_MASK),
+      .LATCHED_IRQ      (IRQ31_IRQ_MASK)
   ) cpu (
       .clk(clk),
       .resetn(reset_n),
@@ -242,6 +284,12 @@ module application_fpga (
       .ram_addr_rand(ram_addr_rand),
       .ram_data_rand(ram_data_rand),
 
+      .fill_data(ram_fill_data),
+      .fill_state_we(ram_fill_state_we),
+      .fill_acc_we(ram_fill_acc_we),
+      .fill_start(ram_fill_start),
+      .fill_busy(ram_fill_busy),
+
       .cs(ram_cs),
       .we(ram_we),
       .address(ram_address),
@@ -337,6 +385,75 @@ module application_fpga (
   );
 
 
+  // The BLAKE2s core is optional, since it uses a large part of
+  // the FPGA. Without it, the address range reads as zero and it
+  // never asks for the RAM.
+`ifdef BLAKE2S
+  blake2s blake2s_inst (
+      .clk(clk),
+      .reset_n(reset_n),
+
+      .ram_req(blake2s_ram_req),
+      .ram_addr(blake2s_ram_address),
+      .ram_ack(blake2s_ram_ack),
+      .ram_read_data(ram_read_data),
+
+      .cs(blake2s_cs),
+      .we(blake2s_we),
+      .address(blake2s_address),
+      .write_data(blake2s_write_data),
+      .read_data(blake2s_read_data),
+      .ready(blake2s_ready)
+  );
+`else
+  assign blake2s_read_data   = 32'h0;
+  assign blake2s_ready       = blake2s_cs;
+  assign blake2s_ram_req     = 1'h0;
+  assign blake2s_ram_address = 15'h0;
+`endif
+
+
+  // The SHA-512 core is optional, since it uses a large part of
+  // the FPGA. Without it, the address range reads as zero.
+`ifdef SHA512
+  sha512 sha512_inst (
+      .clk(clk),
+      .reset_n(reset_n),
+
+      .cs(sha512_cs),
+      .we(sha512_we),
+      .address(sha512_address),
+      .write_data(sha512_write_data),
+      .read_data(sha512_read_data),
+      .ready(sha512_ready)
+  );
+`else
+  assign sha512_read_data = 32'h0;
+  assign sha512_ready     = sha512_cs;
+`endif
+
+
+  // The field multiplication core is optional, since it uses a large
+  // part of the FPGA and half of the DSPs. Without it, the address
+  // range reads as zero.
+`ifdef FE25519
+  fe25519 fe25519_inst (
+      .clk(clk),
+      .reset_n(reset_n),
+
+      .cs(fe25519_cs),
+      .we(fe25519_we),
+      .address(fe25519_address),
+      .write_data(fe25519_write_data),
+      .read_data(fe25519_read_data),
+      .ready(fe25519_ready)
+  );
+`else
+  assign fe25519_read_data = 32'h0;
+  assign fe25519_ready     = fe25519_cs;
+`endif
+
+
   tk1 tk1_inst (
       .clk(clk),
       .reset_n(reset_n),
@@ -355,9 +472,22 @@ module application_fpga (
       .ram_addr_rand(ram_addr_rand),
       .ram_data_rand(ram_data_rand),
 
+      .ram_fill_data(ram_fill_data),
+      .ram_fill_state_we(ram_fill_state_we),
+      .ram_fill_acc_we(ram_fill_acc_we),
+      .ram_fill_start(ram_fill_start),
+      .ram_fill_busy(ram_fill_busy),
+
+      .spi_dma_ram_req(spi_dma_ram_req),
+      .spi_dma_ram_address(spi_dma_ram_address),
+      .spi_dma_ram_write_data(spi_dma_ram_write_data),
+      .spi_dma_ram_ack(spi_dma_ram_ack),
+
       .spi_ss  (spi_ss),
       .spi_sck (spi_sck),
-      .spi_mosi(spi_mosi),
+      .spi_mosi(spi_mosi_out),
+      .spi_mosi_en(spi_mosi_en),
+      .spi_io0(spi_io0),
       .spi_miso(spi_miso),
 
       .led_r(led_r),
@@ -380,19 +510,38 @@ module application_fpga (
   );
 
 
+  // MOSI is also IO0 of the flash, driven by the flash while the
+  // SPI-master is in dual mode.
+  /* verilator lint_off PINMISSING */
+  SB_IO #(
+      .PIN_TYPE(6'b1010_01),
+      .PULLUP  (1'b1)
+  ) spi_mosi_io (
+      .PACKAGE_PIN(spi_mosi),
+      .OUTPUT_ENABLE(spi_mosi_en),
+      .D_OUT_0(spi_mosi_out),
+      .D_IN_0(spi_io0)
+  );
+  /* verilator lint_on PINMISSING */
+
+
   //----------------------------------------------------------------
   // Reg_update.
   // Posedge triggered with synchronous, active low reset.
   //----------------------------------------------------------------
   always @(posedge clk) begin : reg_update
     if (!reset_n) begin
-      muxed_rdata_reg <= 32'h0;
-      muxed_ready_reg <= 1'h0;
+      muxed_rdata_reg     <= 32'h0;
+      muxed_ready_reg     <= 1'h0;
+      spi_dma_ram_ack_reg <= 1'h0;
+      blake2s_ram_ack_reg <= 1'h0;
     end
 
     else begin
-      muxed_rdata_reg <= muxed_rdata_new;
-      muxed_ready_reg <= muxed_ready_new;
+      muxed_rdata_reg     <= muxed_rdata_new;
+      muxed_ready_reg     <= muxed_ready_new;
+      spi_dma_ram_ack_reg <= spi_dma_ram_ack;
+      blake2s_ram_ack_reg <= blake2s_ram_ack;
     end
   end
 
@@ -460,6 +609,21 @@ module application_fpga (
     touch_sense_we      = |cpu_wstrb;
     touch_sense_address = cpu_addr[9 : 2];
 
+    blake2s_cs          = 1'h0;
+    blake2s_we          = |cpu_wstrb;
+    blake2s_address     = cpu_addr[9 : 2];
+    blake2s_write_data  = cpu_wdata;
+
+    sha512_cs           = 1'h0;
+    sha512_we           = |cpu_wstrb;
+    sha512_address      = cpu_addr[9 : 2];
+    sha512_write_data   = cpu_wdata;
+
+    fe25519_cs          = 1'h0;
+    fe25519_we          = |cpu_wstrb;
+    fe25519_address     = cpu_addr[9 : 2];
+    fe25519_write_data  = cpu_wdata;
+
     irq31_cs            = 1'h0;
     irq31_we            = |cpu_wstrb;
 
@@ -489,7 +653,9 @@ module application_fpga (
             ram_cs          = 1'h1;
             ram_we          = cpu_wstrb;
             muxed_rdata_new = ram_read_data;
-            muxed_ready_new = ram_ready;
+            // Ready from a DMA access in the previous cycle
+            // isn't for the CPU.
+            muxed_ready_new = ram_ready & ~spi_dma_ram_ack_reg & ~blake2s_ram_ack_reg;
           end
 
           RESERVED_PREFIX: begin
@@ -529,6 +695,24 @@ module application_fpga (
                 muxed_ready_new = touch_sense_ready;
               end
 
+              BLAKE2S_PREFIX: begin
+                blake2s_cs      = 1'h1;
+                muxed_rdata_new = blake2s_read_data;
+                muxed_ready_new = blake2s_ready;
+              end
+
+              SHA512_PREFIX: begin
+                sha512_cs       = 1'h1;
+                muxed_rdata_new = sha512_read_data;
+                muxed_ready_new = sha512_ready;
+              end
+
+              FE25519_PREFIX: begin
+                fe25519_cs      = 1'h1;
+                muxed_rdata_new = fe25519_read_data;
+                muxed_ready_new = fe25519_ready;
+              end
+
               FW_RAM_PREFIX: begin
                 fw_ram_cs       = 1'h1;
                 muxed_rdata_new = fw_ram_read_data;
@@ -560,6 +744,32 @@ module application_fpga (
         endcase  // case (area_prefix)
       end
     end
+
+    // The SPI DMA in tk1 gets to write to RAM, and the BLAKE2s
+    // core to read from it, in cycles where the CPU isn't
+    // accessing the RAM. The read data is descrambled using the
+    // address, so the address of a BLAKE2s read is held in the
+    // cycle after, stalling any other access.
+    spi_dma_ram_ack = 1'h0;
+    blake2s_ram_ack = 1'h0;
+    if (blake2s_ram_ack_reg) begin
+      ram_cs          = 1'h0;
+      ram_we          = 4'h0;
+      ram_address     = {1'h0, blake2s_ram_address};
+    end
+    else if (spi_dma_ram_req && !(cpu_valid && (area_prefix == RAM_PREFIX))) begin
+      spi_dma_ram_ack = 1'h1;
+      ram_cs          = 1'h1;
+      ram_we          = 4'hf;
+      ram_address     = {1'h0, spi_dma_ram_address};
+      ram_write_data  = spi_dma_ram_write_data;
+    end
+    else if (blake2s_ram_req && !(cpu_valid && (area_prefix == RAM_PREFIX))) begin
+      blake2s_ram_ack = 1'h1;
+      ram_cs          = 1'h1;
+      ram_we          = 4'h0;
+      ram_address     = {1'h0, blake2s_ram_address};
+    end
   end
 
 endmodule  // application_fpga
@@ -22,6 +22,7 @@
 #include <sys/types.h>
 
 #include "Vapplication_fpga_sim.h"
+#include "Vapplication_fpga_sim___024root.h"
 #include "verilated.h"
 
 // Clock: 21 MHz, 62500 bps
@@ -293,6 +294,28 @@ double sc_time_stamp()
 	return main_time;
 }
 
+// Keeps track of when firmware hands over to the device app, to be
+// able to measure load-to-start latency in CPU cycles.
+struct latency {
+	vluint64_t cycles;	   // CPU cycles since start
+	vluint64_t last_from_host; // Cycle the last host byte was sent
+	uint8_t started;	   // Last seen value of fw_startup_done
+};
+
+void latency_tick(struct latency *l, uint8_t fw_startup_done)
+{
+	l->cycles++;
+
+	if (fw_startup_done && !l->started) {
+		printf("app started: cycle %llu, %llu cycles after last "
+		       "byte from host\n",
+		       (unsigned long long)l->cycles,
+		       (unsigned long long)(l->cycles - l->last_from_host));
+	}
+
+	l->started = fw_startup_done;
+}
+
 int main(int argc, char **argv, char **env)
 {
 	Verilated::commandArgs(argc, argv);
@@ -300,6 +323,7 @@ int main(int argc, char **argv, char **env)
 	Vapplication_fpga_sim top;
 	struct uart u;
 	struct pty p;
+	struct latency l = {0, 0, 0};
 	int err;
 
 	if (signal(SIGUSR1, sighandler) == SIG_ERR)
@@ -328,6 +352,8 @@ int main(int argc, char **argv, char **env)
 		if (!top.clk) {
 			touch(&top.touch_event);
 			uart_tick(&u);
+			latency_tick(&l,
+			    top.rootp->application_fpga_sim__DOT__fw_startup_done);
 		}
 
 		if (pty_can_recv(&p) && uart_can_send(&u)) {
@@ -335,6 +361,7 @@ int main(int argc, char **argv, char **env)
 
 			pty_recv(&p, &from_host);
 			uart_send(&u, from_host);
+			l.last_from_host = l.cycles;
 		}
 
 		if (uart_recv(&u, &to_host) == 1) {
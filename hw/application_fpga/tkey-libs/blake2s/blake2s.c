@@ -3,7 +3,7 @@
 // blake2s.c
 // ---------
 //
-// A simple BLAKE2s reference implementation.
+// A BLAKE2s implementation based on the reference implementation.
 //
 // See LICENSE for license terms.
 // See README.md in the repo root for info about source code origin.
@@ -13,13 +13,32 @@
 #include "blake2s.h"
 
 #define VERBOSE 0
-#define SHOW_V 0
-#define SHOW_M_WORDS 0
 
-#if VERBOSE || SHOW_V || SHOW_M_WORDS
+#if VERBOSE
 #include <stdio.h>
 #endif
 
+// The BLAKE2s core only exists in the TKey hardware.
+#ifdef __riscv
+#include <tkey/tk1_mem.h>
+
+// TK1 version of the first hardware with the BLAKE2s core. Older
+// hardware traps on access to its address range.
+#define B2S_HW_TK1_VERSION 7
+#define B2S_HW_NAME0 0x626c616b // "blak"
+
+// clang-format off
+static volatile uint32_t *const b2s_tk1_version = (volatile uint32_t *)TK1_MMIO_TK1_VERSION;
+static volatile uint32_t *const b2s_name0       = (volatile uint32_t *)TK1_MMIO_BLAKE2S_NAME0;
+static volatile uint32_t *const b2s_status      = (volatile uint32_t *)TK1_MMIO_BLAKE2S_STATUS;
+static volatile uint32_t *const b2s_src         = (volatile uint32_t *)TK1_MMIO_BLAKE2S_SRC;
+static volatile uint32_t *const b2s_blocks      = (volatile uint32_t *)TK1_MMIO_BLAKE2S_BLOCKS;
+static volatile uint32_t *const b2s_t0          = (volatile uint32_t *)TK1_MMIO_BLAKE2S_T0;
+static volatile uint32_t *const b2s_t1          = (volatile uint32_t *)TK1_MMIO_BLAKE2S_T1;
+static volatile uint32_t *const b2s_h           = (volatile uint32_t *)TK1_MMIO_BLAKE2S_H_FIRST;
+// clang-format on
+#endif
+
 // Cyclic right rotation.
 #ifndef ROTR32
 #define ROTR32(x, y)  (((x) >> (y)) ^ ((x) << (32 - (y))))
@@ -41,18 +60,22 @@ static const uint32_t blake2s_iv[8] = {
 };
 
 
-#if VERBOSE || SHOW_V
-//------------------------------------------------------------------
-//------------------------------------------------------------------
-void print_v(uint32_t *v) {
-  printf("0x%08x, 0x%08x, 0x%08x, 0x%08x\n", v[0],  v[1],  v[2],  v[3]);
-  printf("0x%08x, 0x%08x, 0x%08x, 0x%08x\n", v[4],  v[5],  v[6],  v[7]);
-  printf("0x%08x, 0x%08x, 0x%08x, 0x%08x\n", v[8],  v[9],  v[10], v[11]);
-  printf("0x%08x, 0x%08x, 0x%08x, 0x%08x\n", v[12], v[13], v[14], v[15]);
-  printf("\n");
-}
+// Message schedule.
+static const uint8_t blake2s_sigma[10][16] = {
+  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+  {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+  {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+  {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+  {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+  {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+  {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+  {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+  {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+  {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0}
+};
 
 
+#if VERBOSE
 //------------------------------------------------------------------
 // print_ctx()
 // Print the contents of the context data structure.
@@ -75,141 +98,182 @@ void print_ctx(blake2s_ctx *ctx) {
 #endif
 
 //------------------------------------------------------------------
-// B2S_G macro redefined as a G function.
-// Allows us to output intermediate values for debugging.
+// The G function on local variables, so that the working vector
+// can be kept in registers.
 //------------------------------------------------------------------
-void G(uint32_t *v, uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t x, uint32_t y) {
-#if VERBOSE
-    printf("G started.\n");
-#endif
-
-#if SHOW_V
-    printf("v before processing:\n");
-    print_v(&v[0]);
-#endif
-
-#if SHOW_M_WORDS
-    printf("x: 0x%08x, y: 0x%08x\n", x, y);
-#endif
-
-  v[a] = v[a] + v[b] + x;
-  v[d] = ROTR32(v[d] ^ v[a], 16);
-  v[c] = v[c] + v[d];
-  v[b] = ROTR32(v[b] ^ v[c], 12);
-  v[a] = v[a] + v[b] + y;
-  v[d] = ROTR32(v[d] ^ v[a], 8);
-  v[c] = v[c] + v[d];
-  v[b] = ROTR32(v[b] ^ v[c], 7);
-
-#if SHOW_V
-    printf("v after processing:\n");
-    print_v(&v[0]);
-#endif
-
-#if VERBOSE
-    printf("G completed.\n\n");
-#endif
-}
+#define B2S_G(a, b, c, d, x, y)       \
+  do {                                \
+    a = a + b + (x);                  \
+    d = ROTR32(d ^ a, 16);            \
+    c = c + d;                        \
+    b = ROTR32(b ^ c, 12);            \
+    a = a + b + (y);                  \
+    d = ROTR32(d ^ a, 8);             \
+    c = c + d;                        \
+    b = ROTR32(b ^ c, 7);             \
+  } while (0)
 
 
 //------------------------------------------------------------------
-// Compression function. "last" flag indicates last block.
+// Compression function on the 64 byte block "in". "last" flag
+// indicates last block.
+//
+// The message schedule only depends on the round, never on the
+// data, so the function runs in constant time.
 //------------------------------------------------------------------
-static void blake2s_compress(blake2s_ctx *ctx, int last)
+static void blake2s_compress(blake2s_ctx *ctx, const uint8_t *in, int last)
 {
-    const uint8_t sigma[10][16] = {
-        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
-        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
-        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
-        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
-        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
-        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
-        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
-        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
-        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
-        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0}
-    };
-
     int i;
-    uint32_t v[16], m[16];
+    uint32_t m[16];
+    uint32_t v0, v1, v2, v3, v4, v5, v6, v7;
+    uint32_t v8, v9, v10, v11, v12, v13, v14, v15;
 
 #if VERBOSE
       printf("blake2s_compress started.\n");
 #endif
 
-    // init work variables
-    for (i = 0; i < 8; i++) {
-        v[i] = ctx->h[i];
-        v[i + 8] = blake2s_iv[i];
+    // get little-endian words, straight from memory if aligned
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (((uintptr_t) in & 3) == 0) {
+        for (i = 0; i < 16; i++) {
+            m[i] = ((const uint32_t *) in)[i];
+        }
+    } else
+#endif
+    {
+        for (i = 0; i < 16; i++) {
+            m[i] = B2S_GET32(&in[4 * i]);
+        }
     }
 
-    // low 32 bits of offset
-    // high 32 bits
-#if VERBOSE
-      printf("t[0]: 0x%08x, t[1]: 0x%08x\n", ctx->t[0], ctx->t[1]);
-#endif
-    v[12] ^= ctx->t[0];
-    v[13] ^= ctx->t[1];
+    // init work variables
+    v0 = ctx->h[0];
+    v1 = ctx->h[1];
+    v2 = ctx->h[2];
+    v3 = ctx->h[3];
+    v4 = ctx->h[4];
+    v5 = ctx->h[5];
+    v6 = ctx->h[6];
+    v7 = ctx->h[7];
+    v8 = blake2s_iv[0];
+    v9 = blake2s_iv[1];
+    v10 = blake2s_iv[2];
+    v11 = blake2s_iv[3];
+
+    // low and high 32 bits of offset
+    v12 = blake2s_iv[4] ^ ctx->t[0];
+    v13 = blake2s_iv[5] ^ ctx->t[1];
 
     // last block flag set ?
-    if (last) {
-        v[14] = ~v[14];
-    }
+    v14 = last ? ~blake2s_iv[6] : blake2s_iv[6];
+    v15 = blake2s_iv[7];
+
+    // Ten rounds of the G function applied on rows, diagonal.
+    for (i = 0; i < 10; i++) {
+      const uint8_t *s = blake2s_sigma[i];
+
+      B2S_G(v0, v4,  v8, v12, m[s[ 0]], m[s[ 1]]);
+      B2S_G(v1, v5,  v9, v13, m[s[ 2]], m[s[ 3]]);
+      B2S_G(v2, v6, v10, v14, m[s[ 4]], m[s[ 5]]);
+      B2S_G(v3, v7, v11, v15, m[s[ 6]], m[s[ 7]]);
 
-    // get little-endian words
-    for (i = 0; i < 16; i++) {
-        m[i] = B2S_GET32(&ctx->b[4 * i]);
+      B2S_G(v0, v5, v10, v15, m[s[ 8]], m[s[ 9]]);
+      B2S_G(v1, v6, v11, v12, m[s[10]], m[s[11]]);
+      B2S_G(v2, v7,  v8, v13, m[s[12]], m[s[13]]);
+      B2S_G(v3, v4,  v9, v14, m[s[14]], m[s[15]]);
     }
 
-#if VERBOSE
-      printf("v before G processing:\n");
-      print_v(&v[0]);
-#endif
+    // Update the hash state.
+    ctx->h[0] ^= v0 ^ v8;
+    ctx->h[1] ^= v1 ^ v9;
+    ctx->h[2] ^= v2 ^ v10;
+    ctx->h[3] ^= v3 ^ v11;
+    ctx->h[4] ^= v4 ^ v12;
+    ctx->h[5] ^= v5 ^ v13;
+    ctx->h[6] ^= v6 ^ v14;
+    ctx->h[7] ^= v7 ^ v15;
 
-    // Ten rounds of the G function applied on rows, diagonal.
-    for (i = 0; i < 10; i++) {
 #if VERBOSE
-        printf("Round %02d:\n", (i + 1));
-        printf("Row processing started.\n");
+      printf("blake2s_compress completed.\n");
 #endif
+}
 
-      G(&v[0], 0, 4,  8, 12, m[sigma[i][ 0]], m[sigma[i][ 1]]);
-      G(&v[0], 1, 5,  9, 13, m[sigma[i][ 2]], m[sigma[i][ 3]]);
-      G(&v[0], 2, 6, 10, 14, m[sigma[i][ 4]], m[sigma[i][ 5]]);
-      G(&v[0], 3, 7, 11, 15, m[sigma[i][ 6]], m[sigma[i][ 7]]);
 
-#if VERBOSE
-        printf("Row processing completed.\n");
-        printf("Diagonal processing started.\n");
-#endif
+//------------------------------------------------------------------
+// Add a full block to the byte counter.
+//------------------------------------------------------------------
+static void blake2s_count_block(blake2s_ctx *ctx)
+{
+    ctx->t[0] += 64;
+    if (ctx->t[0] < 64)                 // carry overflow ?
+        ctx->t[1]++;                    // high word
+}
 
-      G(&v[0], 0, 5, 10, 15, m[sigma[i][ 8]], m[sigma[i][ 9]]);
-      G(&v[0], 1, 6, 11, 12, m[sigma[i][10]], m[sigma[i][11]]);
-      G(&v[0], 2, 7,  8, 13, m[sigma[i][12]], m[sigma[i][13]]);
-      G(&v[0], 3, 4,  9, 14, m[sigma[i][14]], m[sigma[i][15]]);
 
-#if VERBOSE
-        printf("Diagonal processing completed.\n");
-        printf("\n");
-#endif
-    }
+//------------------------------------------------------------------
+// Compress "nblocks" full blocks from "in" with the BLAKE2s core,
+// which reads them straight from RAM. Returns 0 without doing
+// anything if there is no core or it can't reach the blocks: they
+// must be word aligned and in RAM.
+//------------------------------------------------------------------
+static int blake2s_compress_hw(blake2s_ctx *ctx, const uint8_t *in,
+    size_t nblocks)
+{
+#ifdef __riscv
+    uintptr_t addr = (uintptr_t) in;
+    size_t i;
 
-#if VERBOSE
-      printf("v after G processing:\n");
-      print_v(&v[0]);
-#endif
+    if (*b2s_tk1_version < B2S_HW_TK1_VERSION || *b2s_name0 != B2S_HW_NAME0)
+        return 0;
 
-    // Update the hash state.
-    for (i = 0; i < 8; ++i) {
-      ctx->h[i] ^= v[i] ^ v[i + 8];
-    }
+    if ((addr & 3) != 0 || addr < TK1_RAM_BASE ||
+        nblocks > TK1_RAM_SIZE / 64 ||
+        addr - TK1_RAM_BASE > TK1_RAM_SIZE - 64 * nblocks)
+        return 0;
 
-#if VERBOSE
-      printf("blake2s_compress completed.\n");
+    for (i = 0; i < 8; i++)
+        b2s_h[i] = ctx->h[i];
+    *b2s_t0 = ctx->t[0];
+    *b2s_t1 = ctx->t[1];
+    *b2s_src = addr;
+    *b2s_blocks = nblocks;              // starts the core
+
+    while ((*b2s_status & (1 << TK1_MMIO_BLAKE2S_STATUS_READY_BIT)) == 0)
+        ;
+
+    for (i = 0; i < 8; i++)
+        ctx->h[i] = b2s_h[i];
+    ctx->t[0] = *b2s_t0;
+    ctx->t[1] = *b2s_t1;
+
+    return 1;
+#else
+    (void) ctx;
+    (void) in;
+    (void) nblocks;
+
+    return 0;
 #endif
 }
 
 
+//------------------------------------------------------------------
+// Compress "nblocks" full blocks from "in", none of them the last.
+//------------------------------------------------------------------
+static void blake2s_compress_blocks(blake2s_ctx *ctx, const uint8_t *in,
+    size_t nblocks)
+{
+    if (blake2s_compress_hw(ctx, in, nblocks))
+        return;
+
+    while (nblocks-- > 0) {
+        blake2s_count_block(ctx);
+        blake2s_compress(ctx, in, 0);
+        in += 64;
+    }
+}
+
+
 //------------------------------------------------------------------
 // Initialize the hashing context "ctx" with optional key "key".
 //      1 <= outlen <= 32 gives the digest size in bytes.
@@ -269,17 +333,32 @@ void blake2s_update(blake2s_ctx *ctx,
       print_ctx(ctx);
 #endif
 
-    for (i = 0; i < inlen; i++) {
-        if (ctx->c == 64) {             // buffer full ?
-            ctx->t[0] += ctx->c;        // add counters
-            if (ctx->t[0] < ctx->c)     // carry overflow ?
-                ctx->t[1]++;            // high word
-            blake2s_compress(ctx, 0);   // compress (not last)
-            ctx->c = 0;                 // counter to zero
+    const uint8_t *p = (const uint8_t *) in;
+    size_t left = 64 - ctx->c;
+
+    // The last block must be compressed by blake2s_final(), so a
+    // block is only compressed here when more input follows it.
+    if (inlen > left) {
+        for (i = 0; i < left; i++)      // fill up the buffer
+            ctx->b[ctx->c++] = p[i];
+        p += left;
+        inlen -= left;
+
+        blake2s_compress_blocks(ctx, ctx->b, 1);
+        ctx->c = 0;
+
+        if (inlen > 64) {               // full blocks, no copy
+            size_t nblocks = (inlen - 1) / 64;
+
+            blake2s_compress_blocks(ctx, p, nblocks);
+            p += 64 * nblocks;
+            inlen -= 64 * nblocks;
         }
-        ctx->b[ctx->c++] = ((const uint8_t *) in)[i];
     }
 
+    for (i = 0; i < inlen; i++)
+        ctx->b[ctx->c++] = p[i];
+
 #if VERBOSE
       printf("Context after blake2s_update processing:\n");
       print_ctx(ctx);
@@ -315,7 +394,7 @@ void blake2s_final(blake2s_ctx *ctx, void *out)
     while (ctx->c < 64) {
         ctx->b[ctx->c++] = 0;
     }
-    blake2s_compress(ctx, 1);
+    blake2s_compress(ctx, ctx->b, 1);
 
     // little endian convert and store
     for (i = 0; i < ctx->outlen; i++) {
@@ -6,6 +6,7 @@
 //======================================================================
 
 #include <stdio.h>
+#include <string.h>
 #include "blake2s.h"
 
 
@@ -115,9 +116,141 @@ void test_one_block_one_byte_message() {
 }
 
 
+//------------------------------------------------------------------
+// selftest_seq()
+// Deterministic sequences (Fibonacci generator) from RFC 7693.
+//------------------------------------------------------------------
+void selftest_seq(uint8_t *out, size_t len, uint32_t seed) {
+  uint32_t t, a, b;
+
+  a = 0xDEAD4BAD * seed;
+  b = 1;
+
+  for (size_t i = 0 ; i < len ; i++) {
+    t = a + b;
+    a = b;
+    b = t;
+    out[i] = (t >> 24) & 0xFF;
+  }
+}
+
+
+//------------------------------------------------------------------
+// test_rfc7693_selftest()
+// The self test from RFC 7693, Appendix E. Hashes keyed and unkeyed
+// messages of lengths up to 1024 bytes, with different digest
+// sizes, and compares a hash of all the digests.
+//------------------------------------------------------------------
+int test_rfc7693_selftest() {
+  const uint8_t blake2s_res[32] = {
+    0x6A, 0x41, 0x1F, 0x08, 0xCE, 0x25, 0xAD, 0xCD,
+    0xFB, 0x02, 0xAB, 0xA6, 0x41, 0x45, 0x1C, 0xEC,
+    0x53, 0xC5, 0x98, 0xB2, 0x4F, 0x4F, 0xC7, 0x87,
+    0xFB, 0xDC, 0x88, 0x79, 0x7F, 0x4C, 0x1D, 0xFE
+  };
+  const size_t b2s_md_len[4] = {16, 20, 28, 32};
+  const size_t b2s_in_len[6] = {0, 3, 64, 65, 255, 1024};
+
+  uint8_t in[1024], md[32], key[32];
+  blake2s_ctx ctx;
+
+  printf("Testing with the RFC 7693 self test.\n");
+
+  blake2s_init(&ctx, 32, NULL, 0);
+
+  for (int i = 0 ; i < 4 ; i++) {
+    size_t outlen = b2s_md_len[i];
+
+    for (int j = 0 ; j < 6 ; j++) {
+      size_t inlen = b2s_in_len[j];
+
+      selftest_seq(in, inlen, inlen);
+      blake2s(md, outlen, NULL, 0, in, inlen);
+      blake2s_update(&ctx, md, outlen);
+
+      selftest_seq(key, outlen, outlen);
+      blake2s(md, outlen, key, outlen, in, inlen);
+      blake2s_update(&ctx, md, outlen);
+    }
+  }
+
+  blake2s_final(&ctx, md);
+  print_digest(md);
+
+  if (memcmp(md, blake2s_res, 32) != 0) {
+    printf("Error: Incorrect digest.\n\n");
+    return 1;
+  }
+
+  printf("Correct digest.\n\n");
+  return 0;
+}
+
+
+//------------------------------------------------------------------
+// test_split_unaligned()
+// Hash messages at every alignment, fed to blake2s_update() in
+// pieces of varying size, and check that the digests match hashing
+// the aligned message in one call. Covers both the buffered path
+// and the path hashing full blocks directly from the input.
+//------------------------------------------------------------------
+int test_split_unaligned() {
+  uint32_t words[(1024 + 4) / 4];
+  uint8_t *buf = (uint8_t *) words;
+  uint8_t key[32];
+  uint8_t md[32];
+  uint8_t expected[32];
+  int errors = 0;
+
+  printf("Testing split and unaligned updates.\n");
+
+  selftest_seq(key, 32, 32);
+
+  for (size_t inlen = 0 ; inlen <= 1024 ; inlen += 31) {
+    for (size_t keylen = 0 ; keylen <= 32 ; keylen += 32) {
+      selftest_seq(buf, inlen, inlen);
+      blake2s(expected, 32, key, keylen, buf, inlen);
+
+      for (size_t offset = 1 ; offset < 4 ; offset++) {
+        blake2s_ctx ctx;
+        size_t pos = 0;
+        size_t piece = 1;
+
+        memmove(buf + offset, buf + offset - 1, inlen);
+
+        blake2s_init(&ctx, 32, key, keylen);
+        while (pos < inlen) {
+          size_t n = piece < inlen - pos ? piece : inlen - pos;
+
+          blake2s_update(&ctx, buf + offset + pos, n);
+          pos += n;
+          piece = (piece * 7 + 13) % 150;
+        }
+        blake2s_final(&ctx, md);
+
+        if (memcmp(md, expected, 32) != 0) {
+          printf("Error: Digest mismatch, length %zu, key length %zu, offset %zu.\n",
+                 inlen, keylen, offset);
+          errors++;
+        }
+      }
+    }
+  }
+
+  if (errors == 0) {
+    printf("All digests match.\n");
+  }
+  printf("\n");
+
+  return errors;
+}
+
+
 //------------------------------------------------------------------
 //------------------------------------------------------------------
 int main(void) {
+  int errors = 0;
+
   printf("\n");
   printf("BLAKE2s reference model started. Performing a set of tests..\n");
   printf("Performing a set of tests.\n");
@@ -126,11 +259,13 @@ int main(void) {
   test_abc_message();
   test_one_block_message();
   test_one_block_one_byte_message();
+  errors += test_rfc7693_selftest();
+  errors += test_split_unaligned();
 
   printf("BLAKE2s reference model completed.\n");
   printf("\n");
 
-  return 0;
+  return errors != 0;
 }
 
 //======================================================================
@@ -25,18 +25,37 @@ enum ioend {
 
 enum ch552cmd {
 	SET_ENDPOINTS = 0x01, // Config USB endpoints on the CH552
+	SET_BIT_RATE = 0x02,  // Change the UART bit rate to the CH552
 	CH552_CMD_MAX,
 };
 
+// UART bit rates between the FPGA and the CH552. Keep in sync with
+// the CH552 code.
+enum uart_bit_rate {
+	UART_BIT_RATE_500K = 0x00, // Default
+	UART_BIT_RATE_1M = 0x01,
+	UART_BIT_RATE_MAX,
+};
+
+// Known byte exchanged at a new bit rate before it is kept.
+// Alternating bits make a wrong bit time show as a wrong byte. Keep
+// in sync with the CH552 code.
+#define UART_BIT_RATE_PROBE 0x55
+
 void write(enum ioend dest, const uint8_t *buf, size_t nbytes);
+int write_nb(enum ioend dest, const uint8_t *buf, size_t nbytes);
+void flush(void);
 int read(enum ioend src, uint8_t *buf, size_t bufsize, size_t nbytes);
 int uart_read(uint8_t *buf, size_t bufsize, size_t nbytes);
 int readselect(int bitmask, enum ioend *endpoint, uint8_t *len);
+int readselect_nb(int bitmask, enum ioend *endpoint, uint8_t *len);
+int read_nb(enum ioend src, uint8_t *buf, size_t bufsize, size_t nbytes);
 void putchar(enum ioend dest, const uint8_t ch);
 void puthex(enum ioend dest, const uint8_t ch);
 void putinthex(enum ioend dest, const uint32_t n);
 void puts(enum ioend dest, const char *s);
 void hexdump(enum ioend dest, void *buf, int len);
 void config_endpoints(uint8_t endpoints);
+int uart_set_bit_rate(enum uart_bit_rate rate);
 
 #endif
@@ -7,6 +7,10 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// Word type that may alias any other type, for accessing byte buffers
+// a word at a time.
+typedef uint32_t __attribute__((may_alias)) word_t;
+
 void *memset(void *dest, int c, unsigned n);
 void *memcpy(void *dest, const void *src, unsigned n);
 void memcpy_s(void *dest, size_t destsize, const void *src, size_t n);
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef TKEY_PERF_H
+#define TKEY_PERF_H
+
+#include <stdint.h>
+
+// Access to the cycle and instructions retired counters of the CPU,
+// for measuring how long things take. Both counters are 64 bits and
+// count from reset. They are available from TK1 version 7. Older
+// bitstreams trap on the instructions.
+//
+// Typical use:
+//
+//   uint32_t start = perf_cycles();
+//   do_something();
+//   uint32_t spent = perf_cycles() - start;
+//
+// The 32 bit counters wrap after about 3 minutes at 24 MHz, but the
+// difference is still right for anything shorter than that.
+
+// perf_cycles() returns the low 32 bits of the cycle counter.
+static inline uint32_t perf_cycles(void)
+{
+	uint32_t cycles;
+
+	asm volatile("rdcycle %0" : "=r"(cycles));
+
+	return cycles;
+}
+
+// perf_instret() returns the low 32 bits of the number of retired
+// instructions.
+static inline uint32_t perf_instret(void)
+{
+	uint32_t instret;
+
+	asm volatile("rdinstret %0" : "=r"(instret));
+
+	return instret;
+}
+
+// perf_cycles64() returns the full cycle counter.
+static inline uint64_t perf_cycles64(void)
+{
+	uint32_t hi;
+	uint32_t lo;
+	uint32_t hi2;
+
+	// Read again if the low word wrapped between the reads
+	do {
+		asm volatile("rdcycleh %0" : "=r"(hi));
+		asm volatile("rdcycle %0" : "=r"(lo));
+		asm volatile("rdcycleh %0" : "=r"(hi2));
+	} while (hi != hi2);
+
+	return ((uint64_t)hi << 32) | lo;
+}
+
+// perf_instret64() returns the full number of retired instructions.
+static inline uint64_t perf_instret64(void)
+{
+	uint32_t hi;
+	uint32_t lo;
+	uint32_t hi2;
+
+	// Read again if the low word wrapped between the reads
+	do {
+		asm volatile("rdinstreth %0" : "=r"(hi));
+		asm volatile("rdinstret %0" : "=r"(lo));
+		asm volatile("rdinstreth %0" : "=r"(hi2));
+	} while (hi != hi2);
+
+	return ((uint64_t)hi << 32) | lo;
+}
+#endif
@@ -43,6 +43,38 @@ enum syscall_num {
 	TK1_SYSCALL_REG_MGMT = 12,
 	TK1_SYSCALL_STATUS = 13,
 	TK1_SYSCALL_GET_APP_DATA = 14,
+	TK1_SYSCALL_PRELOAD_SET_PUBKEY = 15,
+	TK1_SYSCALL_ERASE_AREAS = 16,
+	TK1_SYSCALL_GET_BOOT_TIMES = 17,
+	TK1_SYSCALL_READ_DATA_VEC = 18,
+	TK1_SYSCALL_ERASE_DATA_START = 19,
+	TK1_SYSCALL_ERASE_DATA_STATUS = 20,
+};
+
+// A piece of the app's storage area to read with sys_readv(). Needs
+// to be held synchronized with storage.h in firmware.
+struct read_vec {
+	uint32_t offset; // Offset in the area
+	void *buf;	 // Where to read to
+	uint32_t len;	 // Bytes to read
+};
+
+// Needs to be held synchronized with boot_times.h in firmware.
+enum boot_phase {
+	BOOT_MAIN = 0,	       // Entered main()
+	BOOT_SCRAMBLE_RAM = 1, // RAM fill started, scrambling set up
+	BOOT_PART_TABLE = 2,   // Partition table read, RAM filled
+	BOOT_LOAD_START = 3,   // Started loading the app
+	BOOT_LOADED = 4,       // App loaded and measured
+	BOOT_CDI = 5,	       // CDI computed
+	BOOT_JUMP = 6,	       // Jumping to the app
+	BOOT_PHASES = 7,
+};
+
+// Low 32 bits of the cycle counter at each boot phase, counting from
+// reset.
+struct boot_times {
+	uint32_t cycles[BOOT_PHASES];
 };
 
 int syscall(uint32_t number, uint32_t arg1, uint32_t arg2, uint32_t arg3);
@@ -52,7 +84,10 @@ int sys_alloc(void);
 int sys_dealloc(void);
 int sys_write(uint32_t offset, void *buf, size_t len);
 int sys_read(uint32_t offset, void *buf, size_t len);
+int sys_readv(struct read_vec *vec, size_t count);
 int sys_erase(uint32_t offset, size_t len);
+int sys_erase_start(uint32_t offset, size_t len);
+int sys_erase_status(void);
 int sys_get_vidpid(void);
 int sys_preload_delete(void);
 int sys_preload_store(uint32_t offset, void *app, size_t len);
@@ -60,4 +95,5 @@ int sys_preload_store_fin(size_t len, uint8_t digest[32],
 			  uint8_t signature[64]);
 int sys_get_digsig(uint8_t digest[32], uint8_t signature[64]);
 int sys_status(void);
+int sys_get_boot_times(struct boot_times *times);
 #endif
@@ -49,6 +49,9 @@
   UDS		0xc2
   UART		0xc3
   TOUCH		0xc4
+  BLAKE2S	0xc5
+  SHA512	0xc6
+  FE25519	0xc7
   FW_RAM	0xd0
   QEMU		0xfe   Not used in real hardware
   TK1		0xff
@@ -72,6 +75,7 @@
 #define TK1_MMIO_TRNG_BASE 0xc0000000
 #define TK1_MMIO_TRNG_STATUS 0xc0000024
 #define TK1_MMIO_TRNG_STATUS_READY_BIT 0
+#define TK1_MMIO_TRNG_ENTROPY_WORDS 0xc0000028
 #define TK1_MMIO_TRNG_ENTROPY 0xc0000080
 
 #define TK1_MMIO_TIMER_BASE 0xc1000000
@@ -89,16 +93,62 @@
 #define TK1_MMIO_UDS_LAST 0xc200001c
 
 #define TK1_MMIO_UART_BASE 0xc3000000
+#define TK1_MMIO_UART_BIT_RATE 0xc3000040
 #define TK1_MMIO_UART_RX_STATUS 0xc3000080
 #define TK1_MMIO_UART_RX_DATA 0xc3000084
 #define TK1_MMIO_UART_RX_BYTES 0xc3000088
+#define TK1_MMIO_UART_RX_WORD 0xc300008c
 #define TK1_MMIO_UART_TX_STATUS 0xc3000100
 #define TK1_MMIO_UART_TX_DATA 0xc3000104
+#define TK1_MMIO_UART_TX_FREE 0xc3000108
+#define TK1_MMIO_UART_TX_BYTES 0xc300010c
 
 #define TK1_MMIO_TOUCH_BASE 0xc4000000
 #define TK1_MMIO_TOUCH_STATUS 0xc4000024
 #define TK1_MMIO_TOUCH_STATUS_EVENT_BIT 0
 
+#define TK1_MMIO_BLAKE2S_BASE 0xc5000000
+#define TK1_MMIO_BLAKE2S_NAME0 0xc5000000
+#define TK1_MMIO_BLAKE2S_NAME1 0xc5000004
+#define TK1_MMIO_BLAKE2S_VERSION 0xc5000008
+#define TK1_MMIO_BLAKE2S_STATUS 0xc5000024
+#define TK1_MMIO_BLAKE2S_STATUS_READY_BIT 0
+#define TK1_MMIO_BLAKE2S_SRC 0xc5000040
+#define TK1_MMIO_BLAKE2S_BLOCKS 0xc5000044
+#define TK1_MMIO_BLAKE2S_T0 0xc5000048
+#define TK1_MMIO_BLAKE2S_T1 0xc500004c
+#define TK1_MMIO_BLAKE2S_H_FIRST 0xc5000080
+#define TK1_MMIO_BLAKE2S_H_LAST 0xc500009c
+
+#define TK1_MMIO_SHA512_BASE 0xc6000000
+#define TK1_MMIO_SHA512_NAME0 0xc6000000
+#define TK1_MMIO_SHA512_NAME1 0xc6000004
+#define TK1_MMIO_SHA512_VERSION 0xc6000008
+#define TK1_MMIO_SHA512_CTRL 0xc6000020
+#define TK1_MMIO_SHA512_CTRL_NEXT_BIT 0
+#define TK1_MMIO_SHA512_STATUS 0xc6000024
+#define TK1_MMIO_SHA512_STATUS_READY_BIT 0
+#define TK1_MMIO_SHA512_BLOCK_FIRST 0xc6000080
+#define TK1_MMIO_SHA512_BLOCK_LAST 0xc60000fc
+#define TK1_MMIO_SHA512_H_FIRST 0xc6000100
+#define TK1_MMIO_SHA512_H_LAST 0xc600013c
+
+#define TK1_MMIO_FE25519_BASE 0xc7000000
+#define TK1_MMIO_FE25519_NAME0 0xc7000000
+#define TK1_MMIO_FE25519_NAME1 0xc7000004
+#define TK1_MMIO_FE25519_VERSION 0xc7000008
+#define TK1_MMIO_FE25519_CTRL 0xc7000020
+#define TK1_MMIO_FE25519_CTRL_MUL_BIT 0
+#define TK1_MMIO_FE25519_CTRL_SQUARE_BIT 1
+#define TK1_MMIO_FE25519_STATUS 0xc7000024
+#define TK1_MMIO_FE25519_STATUS_READY_BIT 0
+#define TK1_MMIO_FE25519_F_FIRST 0xc7000040
+#define TK1_MMIO_FE25519_F_LAST 0xc7000064
+#define TK1_MMIO_FE25519_G_FIRST 0xc7000080
+#define TK1_MMIO_FE25519_G_LAST 0xc70000a4
+#define TK1_MMIO_FE25519_H_FIRST 0xc70000c0
+#define TK1_MMIO_FE25519_H_LAST 0xc70000e4
+
 // This only exists in QEMU, not real hardware
 #define TK1_MMIO_QEMU_BASE 0xfe000000
 #define TK1_MMIO_QEMU_DEBUG 0xfe001000
@@ -135,6 +185,10 @@
 // Deprecated - use _DATA_RAND instead
 #define TK1_MMIO_TK1_RAM_SCRAMBLE 0xff000104
 #define TK1_MMIO_TK1_RAM_DATA_RAND 0xff000104
+#define TK1_MMIO_TK1_RAM_FILL_STATE 0xff000108
+#define TK1_MMIO_TK1_RAM_FILL_ACC 0xff00010c
+#define TK1_MMIO_TK1_RAM_FILL 0xff000110
+#define TK1_MMIO_TK1_RAM_FILL_BUSY_BIT 0
 
 #define TK1_MMIO_TK1_CPU_MON_CTRL 0xff000180
 #define TK1_MMIO_TK1_CPU_MON_FIRST 0xff000184
@@ -145,4 +199,8 @@
 #define TK1_MMIO_TK1_SPI_EN 0xff000200
 #define TK1_MMIO_TK1_SPI_XFER 0xff000204
 #define TK1_MMIO_TK1_SPI_DATA 0xff000208
+#define TK1_MMIO_TK1_SPI_BURST 0xff00020c
+#define TK1_MMIO_TK1_SPI_DMA_DST 0xff000210
+#define TK1_MMIO_TK1_SPI_DMA_LEN 0xff000214
+#define TK1_MMIO_TK1_SPI_MODE 0xff000218
 #endif
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2025 Tillitis AB <tillitis.se>
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <tkey/assert.h>
 #include <tkey/debug.h>
@@ -20,10 +21,27 @@
 // payload fits in a single USB frame on the other side.
 #define USBMODE_PACKET_SIZE 64
 
+// How many times to poll the UART for a reply from the CH552 before
+// giving up. Long enough for the CH552 to give up first, see
+// uart_set_bit_rate().
+#define CH552_REPLY_POLLS 1000000
+
+// TK1 version of the first hardware with UART FIFO fill levels on
+// both sides, RX_WORD and a settable bit rate. Older hardware, like
+// the QEMU model, only has RX_STATUS, RX_DATA, TX_STATUS and TX_DATA.
+#define UART_FIFO_TK1_VERSION 7
+
+// UART divisors for enum uart_bit_rate. A bit is divisor + 1 cycles
+// of the 24 MHz clock.
+static const uint16_t uart_divisors[UART_BIT_RATE_MAX] = {
+    48, // UART_BIT_RATE_500K, the reset value
+    23, // UART_BIT_RATE_1M
+};
+
 static void hex(uint8_t buf[2], const uint8_t c);
 static int discard(size_t nbytes);
-static uint8_t readbyte(void);
-static void writebyte(uint8_t b);
+static void readbytes(uint8_t *buf, size_t nbytes);
+static void writebytes(const uint8_t *buf, size_t nbytes);
 
 struct usb_mode {
 	enum ioend endpoint; // Current USB endpoint with data
@@ -36,20 +54,64 @@ static struct usb_mode cur_endpoint = {
 };
 
 // clang-format off
+static volatile uint32_t* const tk1_version = (volatile uint32_t *)TK1_MMIO_TK1_VERSION;
 static volatile uint32_t* const can_rx  = (volatile uint32_t *)TK1_MMIO_UART_RX_STATUS;
 static volatile uint32_t* const rx      = (volatile uint32_t *)TK1_MMIO_UART_RX_DATA;
+static volatile uint32_t* const rx_fill = (volatile uint32_t *)TK1_MMIO_UART_RX_BYTES;
+static volatile uint32_t* const rx_word = (volatile uint32_t *)TK1_MMIO_UART_RX_WORD;
 static volatile uint32_t* const can_tx  = (volatile uint32_t *)TK1_MMIO_UART_TX_STATUS;
 static volatile uint32_t* const tx      = (volatile uint32_t *)TK1_MMIO_UART_TX_DATA;
+static volatile uint32_t* const tx_free = (volatile uint32_t *)TK1_MMIO_UART_TX_FREE;
+static volatile uint32_t* const tx_fill = (volatile uint32_t *)TK1_MMIO_UART_TX_BYTES;
+static volatile uint32_t* const divisor = (volatile uint32_t *)TK1_MMIO_UART_BIT_RATE;
 static volatile uint8_t*  const debugtx = (volatile uint8_t *)TK1_MMIO_QEMU_DEBUG;
 // clang-format on
 
-// writebyte blockingly writes byte b to UART
-static void writebyte(uint8_t b)
+// uart_fifo_levels returns true if the UART has the FIFO fill level
+// registers and RX_WORD.
+static bool uart_fifo_levels(void)
 {
-	for (;;) {
-		if (*can_tx) {
-			*tx = b;
-			return;
+	return *tk1_version >= UART_FIFO_TK1_VERSION;
+}
+
+// rx_available returns how many bytes can be read from the UART
+// without blocking. Without fill levels it only knows if there is at
+// least one.
+static size_t rx_available(void)
+{
+	if (!uart_fifo_levels()) {
+		return *can_rx ? 1 : 0;
+	}
+
+	return *rx_fill;
+}
+
+// writebytes blockingly writes nbytes bytes from buf to UART. It
+// reads the free space in the transmit FIFO once and fills it without
+// polling in between.
+//
+// Falls back to one byte at a time when the free space reads zero
+// but TX_STATUS says there is room, like on a UART without free space
+// reporting.
+static void writebytes(const uint8_t *buf, size_t nbytes)
+{
+	bool levels = uart_fifo_levels();
+
+	while (nbytes > 0) {
+		size_t n = levels ? *tx_free : 0;
+
+		if (n == 0 && *can_tx) {
+			n = 1;
+		}
+
+		if (n > nbytes) {
+			n = nbytes;
+		}
+
+		nbytes -= n;
+
+		for (; n > 0; n--) {
+			*tx = *buf++;
 		}
 	}
 }
@@ -62,13 +124,10 @@ static void write_with_header(enum ioend dest, const uint8_t *buf,
 	// USB Mode Protocol header:
 	//   1 byte mode
 	//   1 byte length
+	uint8_t header[2] = {dest, nbytes};
 
-	writebyte(dest);
-	writebyte(nbytes);
-
-	for (int i = 0; i < nbytes; i++) {
-		writebyte(buf[i]);
-	}
+	writebytes(header, sizeof(header));
+	writebytes(buf, nbytes);
 }
 
 // write blockingly writes nbytes bytes of data from buf to dest which
@@ -98,9 +157,7 @@ void write(enum ioend dest, const uint8_t *buf, size_t nbytes)
 
 		return;
 	} else if (dest == IO_UART) {
-		for (int i = 0; i < nbytes; i++) {
-			writebyte(buf[i]);
-		}
+		writebytes(buf, nbytes);
 
 		return;
 	}
@@ -119,16 +176,128 @@ void write(enum ioend dest, const uint8_t *buf, size_t nbytes)
 	}
 }
 
-// readbyte reads a byte from UART and returns it. Blocking.
-static uint8_t readbyte(void)
+// write_nb writes as much as fits in the UART transmit FIFO right
+// now of nbytes bytes from buf to dest, without blocking. dest is the
+// same as for write(). For endpoints with a USB Mode Protocol header
+// only whole packets are queued, so a partial write always ends on a
+// packet boundary. IO_QEMU is always written in full, and so is
+// everything on hardware without transmit FIFO fill levels.
+//
+// Returns the number of bytes from buf queued, which might be 0, or
+// negative on error. Call again with the rest later.
+int write_nb(enum ioend dest, const uint8_t *buf, size_t nbytes)
 {
-	for (;;) {
-		if (*can_rx) {
-			return *rx;
+	size_t free = 0;
+	size_t n = 0;
+
+	if (buf == NULL || dest == IO_NONE) {
+		return -1;
+	}
+
+	if (dest == IO_QEMU) {
+		write(dest, buf, nbytes);
+
+		return nbytes;
+	}
+
+	if (!uart_fifo_levels()) {
+		// No transmit FIFO to fill, write it all blockingly.
+		write(dest, buf, nbytes);
+
+		return nbytes;
+	}
+
+	free = *tx_free;
+
+	if (dest == IO_UART) {
+		n = nbytes < free ? nbytes : free;
+		writebytes(buf, n);
+
+		return n;
+	}
+
+	while (n < nbytes) {
+		size_t len = nbytes - n;
+
+		if (len > USBMODE_PACKET_SIZE) {
+			len = USBMODE_PACKET_SIZE;
+		}
+
+		if (len + 2 > free) {
+			break;
 		}
+
+		write_with_header(dest, buf + n, len);
+
+		free -= len + 2;
+		n += len;
 	}
 
-	return 0;
+	return n;
+}
+
+// flush blocks until everything written has left the UART transmit
+// FIFO. The last byte might still be on the wire when it returns.
+void flush(void)
+{
+	if (!uart_fifo_levels()) {
+		while (*can_tx == 0) {
+		}
+
+		return;
+	}
+
+	while (*tx_fill != 0) {
+	}
+}
+
+// readbytes blockingly reads nbytes bytes from UART into buf. It
+// reads the fill level of the receive FIFO once and drains that many
+// bytes without polling in between, four bytes per read when
+// possible.
+//
+// Without fill levels it polls RX_STATUS before every byte.
+static void readbytes(uint8_t *buf, size_t nbytes)
+{
+	if (!uart_fifo_levels()) {
+		for (; nbytes > 0; nbytes--) {
+			while (*can_rx == 0) {
+			}
+
+			*buf++ = *rx;
+		}
+
+		return;
+	}
+
+	while (nbytes > 0) {
+		size_t n = *rx_fill;
+
+		if (n > nbytes) {
+			n = nbytes;
+		}
+
+		nbytes -= n;
+
+		for (; n >= 4; n -= 4) {
+			uint32_t word = *rx_word;
+
+			if (((uintptr_t)buf & 3) == 0) {
+				*(word_t *)buf = word;
+			} else {
+				buf[0] = word & 0xff;
+				buf[1] = (word >> 8) & 0xff;
+				buf[2] = (word >> 16) & 0xff;
+				buf[3] = word >> 24;
+			}
+
+			buf += 4;
+		}
+
+		for (; n > 0; n--) {
+			*buf++ = *rx;
+		}
+	}
 }
 
 // read reads into buf of size bufsize from UART, nbytes or less, from
@@ -151,14 +320,10 @@ int read(enum ioend src, uint8_t *buf, size_t bufsize, size_t nbytes)
 		return 0;
 	}
 
-	int n = 0;
-
-	for (n = 0; n < nbytes; n++) {
-		buf[n] = readbyte();
-		cur_endpoint.len--;
-	}
+	readbytes(buf, nbytes);
+	cur_endpoint.len -= nbytes;
 
-	return n;
+	return nbytes;
 }
 
 // uart_read reads blockingly into buf o size bufsize from UART nbytes
@@ -171,9 +336,7 @@ int uart_read(uint8_t *buf, size_t bufsize, size_t nbytes)
 		return -1;
 	}
 
-	for (int n = 0; n < nbytes; n++) {
-		buf[n] = readbyte();
-	}
+	readbytes(buf, nbytes);
 
 	return 0;
 }
@@ -183,12 +346,20 @@ int uart_read(uint8_t *buf, size_t bufsize, size_t nbytes)
 // Returns how many bytes were discarded.
 static int discard(size_t nbytes)
 {
+	uint8_t sink[16];
 	int n = 0;
 	uint8_t len = nbytes < cur_endpoint.len ? nbytes : cur_endpoint.len;
 
-	for (n = 0; n < len; n++) {
-		(void)readbyte();
-		cur_endpoint.len--;
+	while (n < len) {
+		uint8_t chunk = len - n;
+
+		if (chunk > sizeof(sink)) {
+			chunk = sizeof(sink);
+		}
+
+		readbytes(sink, chunk);
+		cur_endpoint.len -= chunk;
+		n += chunk;
 	}
 
 	return n;
@@ -242,8 +413,11 @@ int readselect(int bitmask, enum ioend *endpoint, uint8_t *len)
 			// Read USB Mode Protocol header:
 			//   1 byte mode
 			//   1 byte length
-			cur_endpoint.endpoint = readbyte();
-			cur_endpoint.len = readbyte();
+			uint8_t header[2] = {0};
+
+			readbytes(header, sizeof(header));
+			cur_endpoint.endpoint = header[0];
+			cur_endpoint.len = header[1];
 		}
 
 		*len = cur_endpoint.len;
@@ -267,6 +441,99 @@ int readselect(int bitmask, enum ioend *endpoint, uint8_t *len)
 	return 0;
 }
 
+// readselect_nb is readselect() without blocking. It only uses what
+// is already in the UART receive FIFO, which keeps receiving while
+// the caller does something else, so an app can poll for the next
+// frame between chunks of work on the previous one.
+//
+// Data from endpoints not in the bitmask is discarded as it arrives.
+//
+// Returns 0 and sets endpoint and len like readselect() if there is
+// a frame from an endpoint in the bitmask, 1 if there is none yet,
+// and negative on error.
+int readselect_nb(int bitmask, enum ioend *endpoint, uint8_t *len)
+{
+	if ((bitmask & IO_UART) || (bitmask & IO_QEMU)) {
+		return -1;
+	}
+
+	for (;;) {
+		if (cur_endpoint.len == 0) {
+			uint8_t header[2] = {0};
+
+			if (rx_available() == 0) {
+				return 1;
+			}
+
+			// The length comes right behind the mode.
+			readbytes(header, sizeof(header));
+			cur_endpoint.endpoint = header[0];
+			cur_endpoint.len = header[1];
+		}
+
+		*len = cur_endpoint.len;
+
+		if (cur_endpoint.endpoint & bitmask) {
+			*endpoint = cur_endpoint.endpoint;
+
+			return 0;
+		}
+
+		// Discard what has arrived from the wrong endpoint
+		uint8_t n = *len;
+		size_t available = rx_available();
+		if (available < n) {
+			n = available;
+		}
+
+		if (discard(n) != n) {
+			assert(1 == 2);
+		}
+
+		if (cur_endpoint.len != 0) {
+			return 1;
+		}
+	}
+}
+
+// read_nb is read() without blocking. It reads at most nbytes of what
+// has already been received from the current USB endpoint into buf
+// of size bufsize. Call readselect() or readselect_nb() first.
+//
+// Returns the number of bytes read, which might be 0, or negative on
+// error.
+int read_nb(enum ioend src, uint8_t *buf, size_t bufsize, size_t nbytes)
+{
+	size_t n = 0;
+
+	if (buf == NULL || nbytes > bufsize) {
+		return -1;
+	}
+
+	if (src == IO_NONE || src == IO_UART || src == IO_QEMU) {
+		return -1;
+	}
+
+	if (src != cur_endpoint.endpoint) {
+		return 0;
+	}
+
+	n = rx_available();
+
+	if (n > nbytes) {
+		n = nbytes;
+	}
+
+	if (n > cur_endpoint.len) {
+		n = cur_endpoint.len;
+	}
+
+	readbytes(buf, n);
+	cur_endpoint.len -= n;
+
+	return n;
+}
+
 void putchar(enum ioend dest, const uint8_t ch)
 {
 	write(dest, &ch, 1);
@@ -380,3 +647,89 @@ void config_endpoints(uint8_t endpoints)
 
 	write(IO_CH552, cmdbuf, 2);
 }
+
+// ch552_reply waits for a SET_BIT_RATE reply from the CH552 with
+// argument rate, followed by UART_BIT_RATE_PROBE if probe is set.
+//
+// Returns 0 on a matching reply, -1 on any other data or timeout.
+static int ch552_reply(uint8_t rate, bool probe)
+{
+	uint8_t expected[5] = {IO_CH552, 2, SET_BIT_RATE, rate,
+			       UART_BIT_RATE_PROBE};
+	uint8_t reply[5] = {0};
+	size_t len = probe ? 5 : 4;
+
+	if (probe) {
+		expected[1] = 3;
+	}
+
+	for (uint32_t i = 0; i < CH552_REPLY_POLLS; i++) {
+		if (*rx_fill >= len) {
+			readbytes(reply, len);
+
+			return memeq(reply, expected, len) ? 0 : -1;
+		}
+	}
+
+	return -1;
+}
+
+// uart_set_bit_rate negotiates a new UART bit rate with the CH552:
+//
+// 1. Send SET_BIT_RATE and wait for the CH552 to acknowledge it at
+//    the current bit rate.
+// 2. Switch bit rate, send SET_BIT_RATE again with the known byte
+//    UART_BIT_RATE_PROBE and wait for the CH552 to acknowledge it
+//    with the same byte at the new bit rate.
+//
+// If anything fails, including a reply or probe byte that doesn't
+// match, both sides go back to the bit rate they had. A CH552 that
+// doesn't know the command never replies.
+//
+// Only call this when nothing else is expected on the UART, for
+// instance right after start, since unrelated data in the receive
+// FIFO makes the negotiation fail.
+//
+// The CH552 keeps the bit rate over config_endpoints(). The FPGA
+// goes back to the default bit rate on a system reset, and the
+// firmware negotiates the CH552 back to it before one.
+//
+// Returns 0 on success or if already at rate, -1 if still using the
+// old bit rate. Always fails on hardware without a settable bit rate.
+int uart_set_bit_rate(enum uart_bit_rate rate)
+{
+	uint8_t cmdbuf[3] = {SET_BIT_RATE, rate, UART_BIT_RATE_PROBE};
+	uint32_t old_divisor = *divisor;
+
+	if (!uart_fifo_levels() || rate >= UART_BIT_RATE_MAX ||
+	    cur_endpoint.len != 0) {
+		return -1;
+	}
+
+	if (old_divisor == uart_divisors[rate]) {
+		return 0;
+	}
+
+	write(IO_CH552, cmdbuf, 2);
+	if (ch552_reply(rate, false) != 0) {
+		return -1;
+	}
+
+	// Nothing is left to send, the CH552 wouldn't have replied
+	// without all of the command.
+	*divisor = uart_divisors[rate];
+
+	write(IO_CH552, cmdbuf, sizeof(cmdbuf));
+	if (ch552_reply(rate, true) != 0) {
+		*divisor = old_divisor;
+
+		// Drop anything received at the wrong bit rate
+		while (*rx_fill != 0) {
+			(void)*rx;
+		}
+
+		return -1;
+	}
+
+	return 0;
+}
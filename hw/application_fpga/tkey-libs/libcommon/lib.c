@@ -6,9 +6,23 @@
 #include <tkey/lib.h>
 #include <tkey/tk1_mem.h>
 
+// True if a and b have the same offset within a word, so that both
+// can be word aligned at the same time.
+#define SAME_ALIGNMENT(a, b) ((((uintptr_t)(a) ^ (uintptr_t)(b)) & 3) == 0)
+
 void *memset(void *dest, int c, unsigned n)
 {
 	uint8_t *s = dest;
+	uint32_t w = (uint8_t)c;
+
+	w |= w << 8;
+	w |= w << 16;
+
+	for (; n && ((uintptr_t)s & 3); n--, s++)
+		*s = c;
+
+	for (; n >= 4; n -= 4, s += 4)
+		*(word_t *)s = w;
 
 	for (; n; n--, s++)
 		*s = c;
@@ -16,15 +30,46 @@ void *memset(void *dest, int c, unsigned n)
 	return dest;
 }
 
+// Copies by word whenever possible. If the source and destination have
+// different alignment, the destination is aligned and each word is put
+// together from two aligned source words. Only words containing at
+// least one source byte are read.
 __attribute__((used)) void *memcpy(void *dest, const void *src, unsigned n)
 {
-	uint8_t *src_byte = (uint8_t *)src;
-	uint8_t *dest_byte = (uint8_t *)dest;
-
-	for (int i = 0; i < n; i++) {
-		dest_byte[i] = src_byte[i];
+	const uint8_t *s = src;
+	uint8_t *d = dest;
+
+	if (n >= 8) {
+		for (; (uintptr_t)d & 3; n--)
+			*d++ = *s++;
+
+		if (SAME_ALIGNMENT(d, s)) {
+			for (; n >= 16; n -= 16, d += 16, s += 16) {
+				((word_t *)d)[0] = ((const word_t *)s)[0];
+				((word_t *)d)[1] = ((const word_t *)s)[1];
+				((word_t *)d)[2] = ((const word_t *)s)[2];
+				((word_t *)d)[3] = ((const word_t *)s)[3];
+			}
+
+			for (; n >= 4; n -= 4, d += 4, s += 4)
+				*(word_t *)d = *(const word_t *)s;
+		} else {
+			uint32_t shift = ((uintptr_t)s & 3) * 8;
+			const word_t *ws = (const word_t *)((uintptr_t)s & ~3);
+			uint32_t lo = *ws++;
+			uint32_t hi;
+
+			for (; n >= 4; n -= 4, d += 4, s += 4) {
+				hi = *ws++;
+				*(word_t *)d = (lo >> shift) | (hi << (32 - shift));
+				lo = hi;
+			}
+		}
 	}
 
+	for (; n; n--)
+		*d++ = *s++;
+
 	return dest;
 }
 
@@ -34,12 +79,7 @@ void memcpy_s(void *dest, size_t destsize, const void *src, size_t n)
 	assert(src != NULL);
 	assert(destsize >= n);
 
-	uint8_t *src_byte = (uint8_t *)src;
-	uint8_t *dest_byte = (uint8_t *)dest;
-
-	for (size_t i = 0; i < n; i++) {
-		dest_byte[i] = src_byte[i];
-	}
+	(void)memcpy(dest, src, n);
 }
 
 __attribute__((used)) void *wordcpy(void *dest, const void *src, unsigned n)
@@ -60,32 +100,43 @@ void wordcpy_s(void *dest, size_t destsize, const void *src, size_t n)
 	assert(src != NULL);
 	assert(destsize >= n);
 
-	uint32_t *src_word = (uint32_t *)src;
-	uint32_t *dest_word = (uint32_t *)dest;
-
-	for (size_t i = 0; i < n; i++) {
-		dest_word[i] = src_word[i];
-	}
+	(void)wordcpy(dest, src, n);
 }
 
+// Constant time comparison. Compares by word when dest and src have
+// the same alignment. The time depends on n and the alignment, never
+// on the contents.
 int memeq(void *dest, const void *src, size_t n)
 {
-	uint8_t *src_byte = (uint8_t *)src;
-	uint8_t *dest_byte = (uint8_t *)dest;
-	int res = -1;
+	const uint8_t *s = src;
+	const uint8_t *d = dest;
+	uint32_t diff = 0;
 
-	for (size_t i = 0; i < n; i++) {
-		if (dest_byte[i] != src_byte[i]) {
-			res = 0;
-		}
+	if (SAME_ALIGNMENT(d, s)) {
+		for (; n && ((uintptr_t)d & 3); n--)
+			diff |= *d++ ^ *s++;
+
+		for (; n >= 4; n -= 4, d += 4, s += 4)
+			diff |= *(const word_t *)d ^ *(const word_t *)s;
 	}
 
-	return res;
+	for (; n; n--)
+		diff |= *d++ ^ *s++;
+
+	return diff == 0 ? -1 : 0;
 }
 
+// Volatile stores, so the wipe isn't optimized away.
 void secure_wipe(void *v, size_t n)
 {
 	volatile uint8_t *p = (volatile uint8_t *)v;
+
+	for (; n && ((uintptr_t)p & 3); n--)
+		*p++ = 0;
+
+	for (; n >= 4; n -= 4, p += 4)
+		*(volatile word_t *)p = 0;
+
 	while (n--)
 		*p++ = 0;
 }
@@ -47,8 +47,8 @@ int sys_dealloc(void)
 // Write data in `buf` to the app's flash area at byte `offset` within
 // the area.
 //
-// Up to storage area size bytes can be written at once and `offset` must be a
-// multiple of 256 bytes.
+// Up to storage area size bytes can be written at once, at any
+// `offset` within the area.
 //
 // Returns 0 on success.
 int sys_write(uint32_t offset, void *buf, size_t len)
@@ -59,12 +59,24 @@ int sys_write(uint32_t offset, void *buf, size_t len)
 // Read `len` bytes into `buf` at byte `offset` from the app's flash
 // area.
 //
+// Up to storage area size bytes can be read at once.
+//
 // Returns 0 on success.
 int sys_read(uint32_t offset, void *buf, size_t len)
 {
 	return syscall(TK1_SYSCALL_READ_DATA, offset, (uint32_t)buf, len);
 }
 
+// Read `count` pieces of the app's flash area in one system call,
+// each described by an offset, buffer and length in `vec` like for
+// sys_read(). Stops at the first piece that can't be read.
+//
+// Returns 0 on success.
+int sys_readv(struct read_vec *vec, size_t count)
+{
+	return syscall(TK1_SYSCALL_READ_DATA_VEC, (uint32_t)vec, count, 0);
+}
+
 // Erase `len` bytes from `offset` within the area.
 //
 // Both `len` and  `offset` must be a multiple of 4096 bytes.
@@ -75,6 +87,24 @@ int sys_erase(uint32_t offset, size_t len)
 	return syscall(TK1_SYSCALL_ERASE_DATA, offset, len, 0);
 }
 
+// Start erasing `len` bytes from `offset` within the area, like
+// sys_erase(), but return without waiting for the erase to finish.
+// Poll sys_erase_status() until it returns 0 to know when it's done.
+// Other system calls using flash wait for it to finish.
+//
+// Returns 0 on success.
+int sys_erase_start(uint32_t offset, size_t len)
+{
+	return syscall(TK1_SYSCALL_ERASE_DATA_START, offset, len, 0);
+}
+
+// Returns 1 while an erase started by sys_erase_start() is running,
+// 0 when it's done.
+int sys_erase_status(void)
+{
+	return syscall(TK1_SYSCALL_ERASE_DATA_STATUS, 0, 0, 0);
+}
+
 // Returns the TKey Vendor and Product ID.
 int sys_get_vidpid(void)
 {
@@ -97,8 +127,8 @@ int sys_preload_delete(void)
 // `sys_preload_store` many times as you receive the binary from the
 // client. Returns 0 on success.
 //
-// Up to preloaded app area size bytes can be written at once and `offset` must
-// be a multiple of 256 bytes.
+// Up to preloaded app area size bytes can be written at once, at any
+// `offset` within the area.
 //
 // Only available for the verified management app.
 //
@@ -143,3 +173,13 @@ int sys_status(void)
 {
 	return syscall(TK1_SYSCALL_STATUS, 0, 0, 0);
 }
+
+// Copies the cycle counter at each phase of the firmware boot to
+// `times`, for instance to follow how long the boot takes. Index it
+// with enum boot_phase.
+//
+// Returns 0 on success.
+int sys_get_boot_times(struct boot_times *times)
+{
+	return syscall(TK1_SYSCALL_GET_BOOT_TIMES, (uint32_t)times, 0, 0);
+}
@@ -0,0 +1,778 @@
+// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// Generated by tools/gen_comb_tables.py. Do not edit.
+//
+// Fixed-base comb tables for ge_scalarmult_base(), 4-bit
+// signed combs in cached format (Niels coordinates, Z=1).
+// MONOCYPHER_COMB_TABLES selects the number of combs.
+
+#if MONOCYPHER_COMB_TABLES == 1
+static const ge_precomp b_comb[1][8] = {
+{
+	{{7551057,2667017,17467766,15113426,-30519452,
+	  4557650,31553365,-16454512,6586503,-13682095,},
+	 {-7810880,11142391,28851324,-1385078,29164229,
+	  -14799918,11145899,-13780786,-18069948,-16771361,},
+	 {-1279716,3694743,-20661872,8747884,-8203609,
+	  -4510055,-23413096,8080426,-10077596,7462638,},},
+	{{-29464326,11359852,26714842,-6634947,29300106,
+	  2689141,9415243,-11741391,16187193,-15817737,},
+	 {24196291,-4940441,21085500,10134488,-6360362,
+	  7554300,-30214143,1371096,16292808,-6734634,},
+	 {-15340601,-15836902,8267707,-7741659,4535884,
+	  -2834087,29733804,-7291864,29871863,-12134926,},},
+	{{280449,-15761045,13259555,-13225068,22414327,
+	  1424594,-29201274,13297631,31755490,7763568,},
+	 {-32647735,13031767,24798182,-15840207,2969982,
+	  -9209805,-3876469,9144115,17265725,5063118,},
+	 {28122795,2198525,-30457220,-3374193,-267889,
+	  -8221460,-5027334,11229959,-15424048,2710431,},},
+	{{23039151,-812407,18732474,936484,-30449187,
+	  4479998,21654018,9519399,-12595567,-1272760,},
+	 {-14460079,9551344,-4627896,10548932,-6161991,
+	  -13085293,24517217,-1937654,8803366,-1023638,},
+	 {-19288062,-2071640,-8178966,743476,838884,
+	  -10096475,-28479791,16165008,-33472123,-10121197,},},
+	{{12520608,4638710,31014641,6092893,-20100962,
+	  13492788,-16016170,-16023291,21966237,-4611555,},
+	 {9718317,14935137,-33517492,-9651182,25514683,
+	  -4150034,27586456,-13103340,-29065722,4631415,},
+	 {-27996212,13432445,8082540,10514302,-17047311,
+	  -9450845,-8625669,-4754989,-30099589,-16043319,},},
+	{{-140986,12540446,-3647078,-910419,-32907844,
+	  9945973,-25538574,-8168487,24412745,-8842843,},
+	 {-6655554,2109708,13061247,-8091632,18099783,
+	  2694097,12468586,-9582371,-12612976,-15774725,},
+	 {-16179202,-12215002,14746904,8710749,29402711,
+	  -16716396,-1471184,5742439,-17174207,5585904,},},
+	{{23090082,13349381,-31121233,-13133843,3584721,
+	  -15671851,-20541345,6675554,30439867,10411610,},
+	 {-15068752,-6476790,-1556208,-13084559,27198337,
+	  -13933425,-29241721,-11436580,24099273,-5531006,},
+	 {9274004,-15755612,26883301,13925004,30115379,
+	  -7480148,32775568,-9986468,-5515016,-3980041,},},
+	{{-280510,-4531758,-11443600,-5569527,31948146,
+	  -472934,30652345,-505019,23313552,2512041,},
+	 {8321103,3330807,4510805,-2949986,-27601124,
+	  6611878,32869763,-1705315,30301293,-16618197,},
+	 {-12365609,-11571615,11962523,2961320,-31152564,
+	  -11927760,24989997,-5464220,-26196392,-5839453,},},
+},
+};
+
+#elif MONOCYPHER_COMB_TABLES == 2
+static const ge_precomp b_comb[2][8] = {
+{
+	{{-6816601,-2324159,-22559413,124364,18015490,
+	  8373481,19993724,1979872,-18549925,9085059,},
+	 {10306321,403248,14839893,9633706,8463310,
+	  -8354981,-14305673,14668847,26301366,2818560,},
+	 {-22701500,-3210264,-13831292,-2927732,-16326337,
+	  -14016360,12940910,177905,12165515,-2397893,},},
+	{{-12282262,-7022066,9920413,-3064358,-32147467,
+	  2927790,22392436,-14852487,2719975,16402117,},
+	 {-7236961,-4729776,2685954,-6525055,-24242706,
+	  -15940211,-6238521,14082855,10047669,12228189,},
+	 {-30495588,-12893761,-11161261,3539405,-11502464,
+	  16491580,-27286798,-15030530,-7272871,-15934455,},},
+	{{17650926,582297,-860412,-187745,-12072900,
+	  -10683391,-20352381,15557840,-31072141,-5019061,},
+	 {-6283632,-2259834,-4674247,-4598977,-4089240,
+	  12435688,-31278303,1060251,6256175,10480726,},
+	 {-13871026,2026300,-21928428,-2741605,-2406664,
+	  -8034988,7355518,15733500,-23379862,7489131,},},
+	{{6883359,695140,23196907,9644202,-33430614,
+	  11354760,-20134606,6388313,-8263585,-8491918,},
+	 {-7716174,-13605463,-13646110,14757414,-19430591,
+	  -14967316,10359532,-11059670,-21935259,12082603,},
+	 {-11253345,-15943946,10046784,5414629,24840771,
+	  8086951,-6694742,9868723,15842692,-16224787,},},
+	{{9639399,11810955,-24007778,-9320054,3912937,
+	  -9856959,996125,-8727907,-8919186,-14097242,},
+	 {7248867,14468564,25228636,-8795035,14346339,
+	  8224790,6388427,-7181107,6468218,-8720783,},
+	 {15513115,15439095,7342322,-10157390,18005294,
+	  -7265713,2186239,4884640,10826567,7135781,},},
+	{{-14204238,5297536,-5862318,-6004934,28095835,
+	  4236101,-14203318,1958636,-16816875,3837147,},
+	 {-5511166,-13176782,-29588215,12339465,15325758,
+	  -15945770,-8813185,11075932,-19608050,-3776283,},
+	 {11728032,9603156,-4637821,-5304487,-7827751,
+	  2724948,31236191,-16760175,-7268616,14799772,},},
+	{{-28842672,4840636,-12047946,-9101456,-1445464,
+	  381905,-30977094,-16523389,1290540,12798615,},
+	 {27246947,-10320914,14792098,-14518944,5302070,
+	  -8746152,-3403974,-4149637,-27061213,10749585,},
+	 {25572375,-6270368,-15353037,16037944,1146292,
+	  32198,23487090,9585613,24714571,-1418265,},},
+	{{19844825,282124,-17583147,11004019,-32004269,
+	  -2716035,6105106,-1711007,-21010044,14338445,},
+	 {8027505,8191102,-18504907,-12335737,25173494,
+	  -5923905,15446145,7483684,-30440441,10009108,},
+	 {-14134701,-4174411,10246585,-14677495,33553567,
+	  -14012935,23366126,15080531,-7969992,7663473,},},
+},
+{
+	{{33055887,-4431773,-521787,6654165,951411,
+	  -6266464,-5158124,6995613,-5397442,-6985227,},
+	 {4014062,6967095,-11977872,3960002,8001989,
+	  5130302,-2154812,-1899602,-31954493,-16173976,},
+	 {16271757,-9212948,23792794,731486,-25808309,
+	  -3546396,6964344,-4767590,10976593,10050757,},},
+	{{2533007,-4288439,-24467768,-12387405,-13450051,
+	  14542280,12876301,13893535,15067764,8594792,},
+	 {20073501,-11623621,3165391,-13119866,13188608,
+	  -11540496,-10751437,-13482671,29588810,2197295,},
+	 {-1084082,11831693,6031797,14062724,14748428,
+	  -8159962,-20721760,11742548,31368706,13161200,},},
+	{{2050412,-6457589,15321215,5273360,25484180,
+	  124590,-18187548,-7097255,-6691621,-14604792,},
+	 {9938196,2162889,-6158074,-1711248,4278932,
+	  -2598531,-22865792,-7168500,-24323168,11746309,},
+	 {-22691768,-14268164,5965485,9383325,20443693,
+	  5854192,28250679,-1381811,-10837134,13717818,},},
+	{{-8495530,16382250,9548884,-4971523,-4491811,
+	  -3902147,6182256,-12832479,26628081,10395408,},
+	 {27329048,-15853735,7715764,8717446,-9215518,
+	  -14633480,28982250,-5668414,4227628,242148,},
+	 {-13279943,-7986904,-7100016,8764468,-27276630,
+	  3096719,29678419,-9141299,3906709,11265498,},},
+	{{11918285,15686328,-17757323,-11217300,-27548967,
+	  4853165,-27168827,6807359,6871949,-1075745,},
+	 {-29002610,13984323,-27111812,-2713442,28107359,
+	  -13266203,6155126,15104658,3538727,-7513788,},
+	 {14103158,11233913,-33165269,9279850,31014152,
+	  4335090,-1827936,4590951,13960841,12787712,},},
+	{{1469134,-16738009,33411928,13942824,8092558,
+	  -8778224,-11165065,1437842,22521552,-2792954,},
+	 {31352705,-4807352,-25327300,3962447,12541566,
+	  -9399651,-27425693,7964818,-23829869,5541287,},
+	 {-25732021,-6864887,23848984,3039395,-9147354,
+	  6022816,-27421653,10590137,25309915,-1584678,},},
+	{{-22951376,5048948,31139401,-190316,-19542447,
+	  -626310,-17486305,-16511925,-18851313,-12985140,},
+	 {-9684890,14681754,30487568,7717771,-10829709,
+	  9630497,30290549,-10531496,-27798994,-13812825,},
+	 {5827835,16097107,-24501327,12094619,7413972,
+	  11447087,28057551,-1793987,-14056981,4359312,},},
+	{{26323183,2342588,-21887793,-1623758,-6062284,
+	  2107090,-28724907,9036464,-19618351,-13055189,},
+	 {-29697200,14829398,-4596333,14220089,-30022969,
+	  2955645,12094100,-13693652,-5941445,7047569,},
+	 {-3201977,14413268,-12058324,-16417589,-9035655,
+	  -7224648,9258160,1399236,30397584,-5684634,},},
+},
+};
+
+#elif MONOCYPHER_COMB_TABLES == 4
+static const ge_precomp b_comb[4][8] = {
+{
+	{{29046042,-502951,26766862,7118036,-10654422,
+	  7632055,-14806592,-14478237,14830552,9279554,},
+	 {7187607,14950498,-20579223,14566892,9895816,
+	  6745048,9500360,-16052086,-17316775,829562,},
+	 {-32459955,1820280,-228201,14555264,29936779,
+	  3792797,-435741,-10413295,7804245,-6091412,},},
+	{{8210013,-11649609,14735385,-4128526,2930453,
+	  -9779418,-19721790,-3812965,-30996217,5852379,},
+	 {-4445003,-2630741,-10707835,2328316,-24286703,
+	  -8172528,-13122551,-13373141,-24746701,15095741,},
+	 {16141514,6960741,-10469728,10366302,-3649574,
+	  -5065668,6206932,-13948149,23639008,3431883,},},
+	{{-22663325,11404017,15914789,10256588,-9073393,
+	  7545234,-19899181,-14618484,-2504937,-12756430,},
+	 {32488079,11905204,-7522463,8817276,-23188416,
+	  16646812,15613800,-296994,-16882113,-16240588,},
+	 {-23582647,-7231267,18117486,11839086,10829701,
+	  13815707,18481047,-9510405,-28560855,8696539,},},
+	{{-17434170,-949282,-7356756,-15006489,-17022860,
+	  -12616704,13227196,13939150,33276935,6776277,},
+	 {24056534,-362885,-29160372,-14438184,1005636,
+	  -11708389,-14393389,-7495524,177844,2418904,},
+	 {1224820,-16605762,1755365,14842075,21898714,
+	  6100412,-30491935,-5100346,-23305440,-10609029,},},
+	{{9460053,8292263,-12605316,15133345,12331875,
+	  -674963,-13834353,9951710,-7165457,-5859000,},
+	 {2293732,13790695,-12384056,-13610213,-32711689,
+	  3525657,-33411743,16146213,-10033874,7495582,},
+	 {9625519,14440998,27824257,2873806,-26110987,
+	  -36423,12700914,-13920199,1448766,-6168599,},},
+	{{26091043,-5847215,-17831037,4982902,354877,
+	  -544490,7987122,-15088769,-24732494,-15516253,},
+	 {-16772822,-5626318,21409591,12931923,11733537,
+	  4536878,-10283471,13807989,21607883,14988549,},
+	 {32462048,-9740494,-21194532,-16759140,-19418897,
+	  -5204025,-23521374,13705994,5674215,-3157812,},},
+	{{3352371,757340,9121736,11017640,19645255,
+	  -9378014,-12479153,-13385407,791600,11754132,},
+	 {-23135603,-5087107,-11053834,12290486,719509,
+	  13848468,11182174,-6164822,25267749,-598119,},
+	 {-31083731,6074610,-17993323,-15057840,14399447,
+	  -16476794,17371979,3142698,19523759,16477440,},},
+	{{14230002,-6679109,-33462887,-1435889,-30937231,
+	  6618635,-29146479,-4503094,-12284427,-5760614,},
+	 {-20521741,2876458,13930790,-7097972,8549646,
+	  -15067139,-23813337,12287819,25410064,-3071446,},
+	 {-5797169,11445566,-15519246,1784377,-3597679,
+	  12005801,-17121917,8249250,-14975959,-3421836,},},
+},
+{
+	{{-31864556,76708,-13873712,-1727280,-30163799,
+	  -13393765,32658753,7825458,6733072,-44553,},
+	 {27537206,-6642318,33296118,13154000,-7345158,
+	  -2012949,-9401466,14371090,-8041572,-13355743,},
+	 {29303960,-8634894,26559885,14671909,-10373173,
+	  10453047,-5665813,3280092,-32652821,5551267,},},
+	{{24553389,-11146460,-24575008,-10363541,7918536,
+	  -4571980,-25766109,3455148,29217298,4325261,},
+	 {-28362703,-11293492,-26816190,10584182,-17475333,
+	  -13681202,27525341,-11725025,-21611346,-1811582,},
+	 {25240064,16207893,5191202,9726179,8348913,
+	  -4290886,-21047743,1802142,26980565,-10031259,},},
+	{{19254636,-2213697,-11178141,-15288173,23460649,
+	  -16598589,10184233,-13177452,-11919112,15945315,},
+	 {-19826304,-8108606,-26425580,6595704,25916299,
+	  13765688,-14270344,13413035,-26456592,-13278363,},
+	 {23365949,6226636,-19363665,-6816675,23813827,
+	  -6788114,33539090,-6044344,-18178519,-10212398,},},
+	{{-25400199,-730454,27933307,-16605382,-27545233,
+	  2849307,-5655171,-415275,-4930344,-11669526,},
+	 {6955695,-16269017,29178105,3842921,12563065,
+	  522425,20034901,-9559464,-14926552,14434120,},
+	 {1800280,-13552918,-25328542,11535304,-14378945,
+	  -3185368,23297523,-8173189,8649498,7165181,},},
+	{{13030538,13220265,20797310,-11582238,-5044876,
+	  -2768191,18172693,-6593954,-3814724,883706,},
+	 {13336241,-10451144,-29213524,6814246,29705809,
+	  -11930188,20003637,-1628501,-14667759,-15329919,},
+	 {18124519,-7425294,-7765597,14515387,-27320666,
+	  16449194,-5575246,7866911,-7896652,-15064285,},},
+	{{11317263,3807119,23495399,-12358158,5365061,
+	  4738943,30784671,-15213809,-1624569,16331426,},
+	 {-22943996,-12677495,-6675139,-8193823,-934969,
+	  9746957,20161149,3459713,2085824,-7940197,},
+	 {12133621,14742656,-2073817,2430145,11871940,
+	  8013740,-1497784,-3529677,26359648,-8083330,},},
+	{{2087565,-9025049,-10793277,-15306143,5968097,
+	  -15366916,-7533042,13843029,-18389212,-8355308,},
+	 {18358652,-5202775,-13362969,-11006061,29600264,
+	  -10325498,26198410,11229182,-28526618,15345328,},
+	 {32379354,-3925097,-20001827,278744,17035602,
+	  -16499666,27264519,-1383609,22069803,12355572,},},
+	{{-17750103,-12130508,-6287738,-1035759,4079644,
+	  3223894,13339465,-2406186,-17953200,15237839,},
+	 {-26047642,16172371,29681239,-15365054,-31662259,
+	  4934426,-7228869,-208475,25661291,-13596112,},
+	 {-26861389,-8291764,-27128641,-5588244,32418706,
+	  6195248,-15288742,-966150,-19701097,-7123521,},},
+},
+{
+	{{22090704,11019190,27299653,15190773,19972730,
+	  -15698108,-26165127,14347916,-7589315,11661293,},
+	 {-6580339,16199152,-2990032,5898843,-7874441,
+	  16603033,21079250,-4285545,-16960584,-5894040,},
+	 {16467603,-2781554,15639218,-8070709,14181783,
+	  847227,32225768,-9656788,-32283574,-2527625,},},
+	{{33490345,15684278,-22545378,-16087127,-7511571,
+	  16466403,3704281,6767057,7087278,11609560,},
+	 {14005735,3768132,22380040,-14792276,-10318758,
+	  8115619,17833498,11595610,17267640,3114695,},
+	 {27676497,-14581850,13731720,-8936288,14012363,
+	  14001488,15648665,-8680894,-8470109,-4610258,},},
+	{{-27532484,-7419939,26107746,-13439086,27442249,
+	  -12561987,-31002631,8038695,21000070,-3694444,},
+	 {-15222338,-12379729,-9177767,-9498295,25771556,
+	  10783923,32842306,-11265575,15938149,8903209,},
+	 {-7038500,11665966,4760167,13347647,-12346336,
+	  -6867613,-11365089,-5705523,9934120,14520016,},},
+	{{31343240,16023757,16122498,-9788393,31966932,
+	  10887421,-22677401,-5621829,6310661,13806297,},
+	 {14275436,-8361918,-18605674,-8591823,-30917405,
+	  -1093295,-18637481,-3019258,12540755,13300494,},
+	 {202099,8783306,7475667,-13565657,-26048092,
+	  -16230359,-17032859,15005545,-3443644,3986733,},},
+	{{22835624,10469308,30051630,-5095587,27632217,
+	  7596657,-25169765,12032193,1991910,-9015405,},
+	 {-3025851,13072943,-9079700,14591700,-21231754,
+	  12072031,-29854695,-5322807,-8554191,-13500486,},
+	 {-3401665,-6459604,-2579449,12930258,-21103373,
+	  13355102,17230635,-15591013,-15822536,1769882,},},
+	{{18421336,-12342173,29680010,-5882734,3879406,
+	  14563153,18773644,9620162,-29410421,-3087821,},
+	 {-27534794,-3870326,23201300,6240401,23969562,
+	  -15755728,-27774557,-3929995,-14779696,-10189736,},
+	 {-15737402,7496088,-21805569,8666637,-6619153,
+	  108143,20038475,4827077,-4912293,-10827781,},},
+	{{-2616419,14804207,13053250,7973978,-26476966,
+	  6872304,14169391,-8416300,-24104451,-1378201,},
+	 {-62812,4758195,15927311,-16717935,-7902630,
+	  -201629,14096247,-15916730,14185656,4246721,},
+	 {20556971,27249,-21320325,-9973517,21685814,
+	  10736004,-31781843,-7209859,-5831035,8340502,},},
+	{{-3602029,3396912,18766048,-6576390,33470977,
+	  -14003447,2079897,-6181721,-26560594,-14012717,},
+	 {14722029,765909,-24446981,477380,-15599194,
+	  1296369,1650977,12891868,10723440,-10738441,},
+	 {23301878,4076959,-26676131,4908358,-7175793,
+	  117468,22821818,6305730,3798654,1517942,},},
+},
+{
+	{{21978428,-2557093,-32572204,-16078050,5094859,
+	  -1753621,9718268,-15290215,6892967,-4873432,},
+	 {20026818,10559593,21524581,-16477440,-20054757,
+	  2079852,-22204527,-7565836,28940584,-6224911,},
+	 {-6607549,-15693068,17871639,13557144,481186,
+	  11138178,26845948,4854169,-8118086,428183,},},
+	{{-20968684,-14731070,9865884,-5704952,80032,
+	  -8050541,4157759,2968771,22003510,8756537,},
+	 {-13071080,3012834,7392452,10675129,-3391997,
+	  -8902760,32528129,-8439329,-21017320,2975890,},
+	 {3414000,12835687,-3248378,9228358,33200372,
+	  -14209063,-31109888,9225257,-7821027,-2391785,},},
+	{{-22803184,-7375737,-29819941,5580416,-22033239,
+	  6192987,11068998,7232187,14162115,6226319,},
+	 {15247526,16538039,11092487,-620536,15204748,
+	  15865735,32072640,-7295266,-30298665,15449373,},
+	 {-11527625,8763267,-30632523,-480519,-7454212,
+	  7684755,1136699,-1409770,23819979,2897375,},},
+	{{1139128,-7407226,-25142275,-509956,2864828,
+	  6329766,26617404,-4726174,-11057350,13715990,},
+	 {-19191450,13221920,11131142,15047568,14776264,
+	  4886419,-14485024,16509374,-16470300,9078778,},
+	 {-14506385,-14179548,15877977,15037679,4877621,
+	  -13389701,-21108558,-1990421,24766385,9808473,},},
+	{{-17164206,-12443638,-5555258,16337666,8016031,
+	  12643202,-23908378,11141954,-3538772,-7829984,},
+	 {-26492365,-2725190,-26543968,4499083,3034650,
+	  -13108638,9001956,461830,16798441,5338049,},
+	 {-20499019,16022643,-12314959,-54828,-18733309,
+	  11277508,25410357,7711385,-22305017,7530869,},},
+	{{33350642,766687,-7970569,-11337693,30868055,
+	  -14253931,6934945,8060534,18974459,-9329602,},
+	 {27740755,8369737,29704459,-15190199,23865320,
+	  -744379,-31516357,4614034,-29635948,-12834786,},
+	 {26543736,10879830,-29479471,14800862,-17631678,
+	  3327764,-20178740,-5523604,20727639,10461276,},},
+	{{-32766145,2071404,19432901,-16266984,27970064,
+	  16160827,-23708678,-11363244,-20172797,-11880633,},
+	 {-19490773,-9208066,11202405,842518,-21632958,
+	  -5538983,22976142,-13928473,19784024,2096385,},
+	 {7846272,7741753,-14418888,3076350,-12028596,
+	  -15125116,26978201,12885175,20962307,6020502,},},
+	{{-11392578,6623239,-5596878,13032400,-32195363,
+	  8052902,-13219507,15665706,-27534613,-1146900,},
+	 {-33394089,12890689,9344853,15004767,14399248,
+	  5851665,-33277643,9185504,16191679,-6755998,},
+	 {-25537938,-6299125,-33357547,-7009081,-6155598,
+	  4370782,28138243,-96487,-26955235,-3953869,},},
+},
+};
+
+#elif MONOCYPHER_COMB_TABLES == 8
+static const ge_precomp b_comb[8][8] = {
+{
+	{{-15752178,-11494754,-6426447,-8433176,2876466,
+	  -12823160,-9322849,16126248,19115884,14972291,},
+	 {21057538,10566292,10041334,12782494,6496126,
+	  -597710,2773662,-16428927,2054917,7337456,},
+	 {-20495528,12757699,-25575313,7992242,-14526876,
+	  -7635259,4031826,8967894,-2497148,15127021,},},
+	{{12878977,-11396226,-26356864,-7088824,-10880430,
+	  9831678,31277259,-5573109,-11456524,-15098410,},
+	 {32275483,-11482845,-10929704,15760432,21886918,
+	  4516458,-29709114,-7148832,30178882,13265882,},
+	 {-30996698,2442180,12223591,-10405075,-2753395,
+	  -6899222,-4885640,3081754,-12821956,9505405,},},
+	{{26520806,-10313270,1003004,13160583,27556281,
+	  5037523,-16590236,-6853795,-14395257,8083269,},
+	 {-5093501,8642088,-12722163,-9395286,9615655,
+	  5674310,3008274,-11644803,30803886,8482912,},
+	 {-22798515,-6205633,26100161,15796096,16982500,
+	  -4015748,-32455516,-4742033,815081,-10706964,},},
+	{{21371271,13578437,-5248167,-8403892,-19140399,
+	  14254366,-32138889,749048,15247890,-15124595,},
+	 {-32289341,10894151,4654354,-13469075,-7023870,
+	  14401348,7116561,13234762,995773,-1455516,},
+	 {31043814,-12158889,-26218270,85835,-31107865,
+	  4793620,-32765474,-6735417,25752341,1196386,},},
+	{{-29514863,-9502023,-23976047,-1639392,16373573,
+	  1834775,-200293,-7940249,-31361971,-7931023,},
+	 {23397630,9456880,-10437494,4570889,-1168899,
+	  14328631,3504345,-4138006,-29180169,-14880557,},
+	 {-10045180,-5253352,27831634,-9748948,-5310782,
+	  13434296,24920357,-1566117,-25204717,11318750,},},
+	{{-3007320,1090439,-19889480,-1698678,-27619491,
+	  13125440,-22475958,16161743,-4180145,11971209,},
+	 {-17221212,-5599300,7641934,-7404927,28650997,
+	  12798270,-4802345,-12607128,30931226,-13617471,},
+	 {-25243030,-11600226,28034591,-5087436,16534930,
+	  -13974928,8670699,-1203538,16123503,12266903,},},
+	{{151615,3297136,22664116,-11143026,974163,
+	  -6608620,9843524,-3727832,-26629980,8867373,},
+	 {-21970700,-8633023,-21099186,-9743437,-10188400,
+	  8294085,-27909249,15882629,14683264,16216895,},
+	 {17128741,7736721,-22303088,-11186422,17787576,
+	  12244715,-1486246,3489781,-10481216,4640579,},},
+	{{-1448671,-6325255,9648987,15791181,-20766178,
+	  10049303,-13055520,-15092465,-23443761,2911454,},
+	 {3800930,15515326,28685864,6844346,-17214301,
+	  -13767236,-31719035,-11624117,-8581767,1511874,},
+	 {3653088,-7747192,-3072693,-10317966,-1600656,
+	  9469727,-702105,-10756901,-14141672,-5200369,},},
+},
+{
+	{{-32252595,-7739986,-30139020,-778233,-32925892,
+	  -13559894,27206532,-1213012,-24251338,508647,},
+	 {12791063,-11720789,-6892498,-7144980,-28254805,
+	  -10496689,32145062,-14100159,-22749969,1012990,},
+	 {526791,-647755,31417632,-556488,-13328471,
+	  -16269267,26689745,-7294293,-5111363,2816964,},},
+	{{-28371933,6376601,9329060,6871292,-11512309,
+	  -10940267,-7599779,13823918,20556186,5875378,},
+	 {-14214904,-11435515,-33513288,-13700142,-19407978,
+	  15363642,-3629192,-3050942,30624171,6147865,},
+	 {7774188,-12084579,-8319517,14054353,-14716060,
+	  11513602,6371676,2490958,4820758,-16082564,},},
+	{{-13323095,-556894,11387997,11619359,24019722,
+	  -16194959,13686880,4990271,-9486492,-5812324,},
+	 {-6053108,-12603030,-25738589,-12841027,-10889015,
+	  6209680,25668398,-7875251,13834978,-1667056,},
+	 {29998581,-7917400,-28646289,1354150,-29730772,
+	  -13879433,-31874483,-615483,29950993,11819779,},},
+	{{23263220,6223156,29924185,-2563539,27585596,
+	  -15383454,-30015740,12238948,26457895,2378992,},
+	 {-26734796,4921550,-17290323,-8894411,-23487460,
+	  -14056477,-24181489,-3027709,108965,15514442,},
+	 {-5059944,398583,12316385,12278588,-10664270,
+	  14160997,-3706613,-11070752,27288031,5666184,},},
+	{{-10762097,-10828961,30745444,12322793,-27589754,
+	  -3182586,6509867,-9819049,-6195894,-9337559,},
+	 {26268366,-4441749,17239681,-16560148,11955667,
+	  4228409,-1183995,785185,-12191817,-15861565,},
+	 {-16939466,822592,18610387,13635606,-3418644,
+	  7453346,25871454,9134716,-15202629,5688164,},},
+	{{-17102672,-9209820,22700892,-2965648,-19880934,
+	  3745454,24176768,-16113839,10869761,-8991803,},
+	 {31169991,10741659,6257389,-8791045,-9198283,
+	  -9119584,-13722610,-10433552,5821440,-5440585,},
+	 {15509128,10693222,6979695,-2049189,-18665881,
+	  11549641,27568275,7061343,4921351,-15742317,},},
+	{{-2526531,-207497,-716982,2527041,-22051462,
+	  -14619009,4846790,3256814,25798549,3090131,},
+	 {23419272,8242990,-3937946,15851059,6686672,
+	  6204919,-13362786,10908982,26415115,3071348,},
+	 {29449963,13770414,13314385,-9817949,-9428564,
+	  -1908317,808159,11456459,16455359,9421121,},},
+	{{-32509815,-11689301,29108724,-2475069,-7707603,
+	  -9854165,-15340825,-16126534,10364882,-847622,},
+	 {29331986,13652228,-7607483,-1911375,22909119,
+	  -6566830,-19895773,15351537,-1330162,-5265024,},
+	 {11359599,-1035494,31755527,-5132889,-29169646,
+	  13610888,23536290,5790806,12293071,-486659,},},
+},
+{
+	{{-14788781,7005820,19869282,12311622,22185856,
+	  -9549312,-11916414,-13983390,-10445178,-10975981,},
+	 {9853769,-325579,-16733128,-11082441,18677901,
+	  8262616,14303890,8211827,-29345789,-9926023,},
+	 {-29527400,-12952597,-5645456,124019,-4120043,
+	  -1913404,-9618782,14149139,12600041,-5508792,},},
+	{{14453132,14503493,18620709,13982715,15156101,
+	  11814686,-30589157,-14334551,5336383,13640840,},
+	 {14684068,13011998,32047826,-15608687,682312,
+	  -16410404,-16007131,3217140,-1899027,-3482394,},
+	 {-23083577,9504853,17847823,-6294203,22621799,
+	  8548360,3319417,16124732,31686284,9343067,},},
+	{{31291540,-2462840,25774036,-7240336,31768417,
+	  5009458,1309940,-2553662,6128609,3635127,},
+	 {-24975754,-14391862,-20335962,-13608813,5821446,
+	  12424866,-13278876,-2734881,-357649,5622163,},
+	 {17508912,-3573675,12344572,-866704,-20375162,
+	  4197172,-20852138,-4088462,-29175439,5407029,},},
+	{{-20113886,16558566,1423721,1790289,-2547109,
+	  5533025,25306650,-12476933,26468450,11829612,},
+	 {-11452592,-6398524,18918469,-5853286,4611142,
+	  -16252361,-13572794,-11304213,-30457986,-5977551,},
+	 {3624732,7139851,28705705,-12052586,-5255025,
+	  -9314384,2412718,4200858,-13056064,4264689,},},
+	{{75635,3996496,-22782028,6119072,15620795,
+	  6825057,-23007754,6714507,29613763,-12983724,},
+	 {28759609,-10351306,-1658873,-1377093,11626085,
+	  -16559668,14253182,9997367,18948293,10950620,},
+	 {-9972554,78680,-23752944,16360874,16882650,
+	  6159490,-15939873,6370425,-4575924,2713197,},},
+	{{18063111,-968125,-3921614,-4800548,282738,
+	  -15057573,-22122642,-2627472,-1149007,-8491764,},
+	 {27247551,5927882,6783919,-6620280,21695746,
+	  12051563,-16663770,4959971,-26743062,-13369849,},
+	 {-3942190,8552974,-19804917,5870013,-3314788,
+	  6114289,-29506802,6418798,-20856424,-2085168,},},
+	{{-3642387,-14607173,22972906,7755359,-9594545,
+	  -10142246,-29939814,5059668,-17486624,14757717,},
+	 {-16627558,9657786,-27661872,5949094,5890555,
+	  8074026,15161838,1995015,-20560615,15695934,},
+	 {11894912,-12554799,9514968,-6597446,-28749921,
+	  -9181239,-23417315,15702229,28370214,-4335752,},},
+	{{-28328177,-14220376,-3605076,-6457973,4332012,
+	  15243013,-1485443,-977314,-21688742,2405232,},
+	 {-1399095,10030674,-22463795,10968402,-33154240,
+	  -1702794,-33389272,602792,32316519,-829493,},
+	 {-33466358,-3584583,-8126712,5434754,-31063539,
+	  5428524,-1516870,-5635188,23961241,7459686,},},
+},
+{
+	{{22122238,2593182,-12687709,-2562769,5759535,
+	  2817575,25411043,10805516,-29292487,-14240790,},
+	 {-16194266,-8538241,-4517961,-16442410,19772705,
+	  2491385,-6658131,-11618510,-12770149,-2870892,},
+	 {9350032,2474747,12359580,-9690969,-13486094,
+	  12502289,-1758045,7562505,-14181316,9662760,},},
+	{{8071139,5619039,1766200,-10480082,-21648798,
+	  -11096217,-23587990,-1482138,-7689140,6712582,},
+	 {9799081,-8260924,9007334,-1781165,-8772093,
+	  4345923,-1595247,-12228155,-727820,-11818581,},
+	 {-28727745,16567454,2885571,2820721,-10807696,
+	  291705,16707959,-1255407,8359465,-3805342,},},
+	{{2414475,-6533396,6267407,-10835766,-25652980,
+	  12781866,18716362,-3201639,-3317103,-15240540,},
+	 {-23324867,42882,3058181,-5653983,8742736,
+	  -2122438,-6602967,-11530367,24911966,-16608615,},
+	 {-20439875,3381090,-5439898,-9251295,-10690494,
+	  -9874771,-1017211,11684883,-8095139,-9317080,},},
+	{{-4285125,15464952,-17843460,-3855321,13064093,
+	  2957656,-2992871,-11889365,16920094,2704692,},
+	 {-23516481,-6754677,19358446,16436000,-29501168,
+	  -5813048,21592079,-1296358,22137236,2863437,},
+	 {31339792,-5807418,11285479,-12166905,-1312446,
+	  -5999174,-526439,-8311135,-31971118,16456804,},},
+	{{-32386101,-3672402,-22669606,-8287648,-33391322,
+	  -2641926,8446523,2237540,7973350,9703007,},
+	 {-307293,-6849158,-31796161,9196549,-9385962,
+	  -11148457,31507040,14181330,-28554086,-14914334,},
+	 {-18536923,15821765,32911408,1968157,-28054197,
+	  -16389857,25717044,9991305,-1214091,-13528204,},},
+	{{28534809,-7293932,9440951,9597113,15752471,
+	  -11182039,28235829,-12697214,-26621686,2097157,},
+	 {29842484,16499309,7740376,15706014,16456225,
+	  -14105637,-26455116,2231227,21837652,11336677,},
+	 {-28050164,12448654,32822342,2607298,13525716,
+	  5334883,-8443314,8984897,15114968,-7975493,},},
+	{{12676122,8308339,10024840,5948042,7975677,
+	  14466639,21782532,7890,18135652,-12536415,},
+	 {8566264,-959192,-23185021,15022759,-17926390,
+	  276122,8153165,-15220940,-7112551,16125932,},
+	 {315295,-10795118,28051969,-1826113,2034732,
+	  -1618277,-427888,-14913186,-26914722,-3196398,},},
+	{{-22841,-9365680,29721282,-15825771,-3682239,
+	  11227557,-16461125,9380434,21901107,-438484,},
+	 {21713373,-5704924,-8571281,10296944,12270231,
+	  -6488442,16549855,-1977805,14960670,15576780,},
+	 {15558053,-1061953,6629320,-367758,17470209,
+	  -3956636,-20187728,398280,-10684667,2244387,},},
+},
+{
+	{{-20576269,-4426890,12182006,-13585184,-6496458,
+	  4990141,-21640649,-6948193,-20876246,-7714403,},
+	 {-854007,-7566068,6634161,1360526,23826907,
+	  -5410279,10938356,-12464322,10051401,6122284,},
+	 {13268904,12496625,10638902,6444154,20847363,
+	  9407954,-9008392,-56169,-14282333,4555290,},},
+	{{-23490360,1727378,-23271670,-8956764,7564162,
+	  -7328417,-31992497,-1205705,-20511800,3451179,},
+	 {-8661995,8028033,-17198320,16523463,3694509,
+	  15781368,-20242827,-14053127,-21510721,16478743,},
+	 {31677123,-5455764,-12190802,-5986050,-25760503,
+	  6138661,25513440,8856133,-30653241,15276658,},},
+	{{-25530529,3369511,-306495,-7937733,-21271690,
+	  -7752812,-7211966,13692161,-28126583,680660,},
+	 {8422815,-11262180,31257080,751675,20992815,
+	  5089991,-4118680,16388295,-26189423,14402389,},
+	 {31611140,10214503,32945455,14648476,14621554,
+	  3407009,17201452,-4235278,-20409049,-12781078,},},
+	{{23062627,-2422242,-10786892,-2605668,-22634818,
+	  3776713,30483705,5330632,-26632433,6202721,},
+	 {14228389,12349516,21008343,7880822,-22138117,
+	  11070774,-18694061,-9335261,-1202050,6854562,},
+	 {-24296856,2751886,-13248375,-8974730,22466779,
+	  10856270,32398601,10143411,-3407233,8126572,},},
+	{{-10573169,7573015,-31251678,-11435894,-16976904,
+	  4206218,31421454,4363345,-24374163,6210452,},
+	 {-3446326,-2734140,-20741454,160757,28711947,
+	  -4537298,-10300669,-13395751,-18868595,-10658519,},
+	 {16307863,-12617408,27341612,-2209290,19371099,
+	  -11242198,-26454603,-7502886,12013318,-6458606,},},
+	{{-31933335,-16553122,-15881518,-15206110,-11166649,
+	  -1339991,-29681564,-13757460,21799934,7238630,},
+	 {14262114,5235270,-17038236,-1352105,31472939,
+	  -11478042,-30862159,16315786,-32549351,7489190,},
+	 {-19907444,-7540839,-13275342,3541929,11475968,
+	  8413589,27274045,11135271,-1199473,6876684,},},
+	{{11877459,-7642015,-28715051,-4779062,11662460,
+	  5888136,32756213,-12002432,1110168,-12382805,},
+	 {-19753863,48945,-30746938,-4290383,-6800971,
+	  -3889802,-3594704,13134849,8852798,-12840139,},
+	 {6334874,-15831434,-30839502,-655642,-20330944,
+	  12767622,-16416533,7930200,-7056323,-11347397,},},
+	{{11277228,-16678360,-12407466,-15997635,-12460221,
+	  12562118,22310841,-15347374,-13409526,4751988,},
+	 {21038082,4820692,-14181376,554932,-28394387,
+	  2479297,15359757,-14519382,24011830,-7167808,},
+	 {-30333529,9450638,-29436534,3647497,23636570,
+	  -14478838,-7364151,-6750527,-14338971,13292042,},},
+},
+{
+	{{-20875469,7233980,12447859,-4395409,-29920252,
+	  -9367745,-32833640,-15685776,942989,16433468,},
+	 {-15604423,2315541,9539517,2565891,24153090,
+	  11444020,27509287,14546382,-12234892,8406036,},
+	 {13410514,14725105,31604718,10347776,-20111988,
+	  8160208,15516064,3708927,-21240772,8477900,},},
+	{{-3842264,9577518,-7304762,-1998617,12575954,
+	  -12421323,-4369451,4636505,-19911325,15320868,},
+	 {-26200487,4478664,-17680316,-3123240,11815723,
+	  4290691,20296731,-11817655,-11903234,13846231,},
+	 {-25231303,-12031650,-22160720,14071872,266272,
+	  2219233,-12069469,6677716,23910609,13676587,},},
+	{{19836310,8844410,6309381,3282252,570901,
+	  -6754476,9353790,-10533480,32809864,13117479,},
+	 {28643510,5828967,-19546065,-10884063,17574654,
+	  -3525116,17769110,7954656,-9927177,4101479,},
+	 {26774610,-6157189,-15885158,-10501855,6948643,
+	  6327532,-20103001,-5781489,-20591774,-15618890,},},
+	{{-21264449,1047230,-32852541,439846,27389419,
+	  7826268,-26553307,-6831667,-28106351,-3623573,},
+	 {-21578269,-11452862,11274668,-16191888,971373,
+	  -14341566,3504132,13768123,-11016041,-2597369,},
+	 {-21862244,-14107239,-18398090,3056894,-31683155,
+	  -5427942,306357,-8014954,24339922,-6058754,},},
+	{{-23955640,4134561,27904357,660166,-11699698,
+	  -135607,8102729,4552721,-14518041,7676279,},
+	 {-10502536,621547,-7237881,14850351,-4380217,
+	  -5620181,16500062,-9484540,29386600,1135684,},
+	 {24912499,-15433031,-5530951,-15928086,22640742,
+	  11903247,4108152,-16650352,-27796790,-16052040,},},
+	{{-32071722,-6483654,-710314,9410094,-2379941,
+	  -9128554,18374183,16347812,-854760,-8636973,},
+	 {22320898,-12270720,-21690078,10154233,-1670523,
+	  -13435246,4501549,2803621,30254338,-3129501,},
+	 {22403186,8869794,7251741,11503811,-18279111,
+	  -9598893,-27988729,8858968,9543299,-9446362,},},
+	{{8969958,11330521,-13028741,3693818,-10092383,
+	  -15762739,4572012,-10320336,-8510701,11579514,},
+	 {16986293,-7297008,-19719194,7898913,-12420133,
+	  1544016,32716590,-886409,-3509760,8748223,},
+	 {-21647405,5424484,-8093375,-3646141,18601255,
+	  16416658,1897963,16495326,-30562409,-550249,},},
+	{{3913467,11706194,-14649226,-13899645,-20021941,
+	  3415247,29176809,15795878,-30336489,-611456,},
+	 {-29482798,-4200189,-30165763,-656042,29444410,
+	  -6399000,1508126,3476313,19164641,-8733860,},
+	 {-4386207,-5729952,30804798,12645777,-28550692,
+	  13807174,33496062,10720537,-11662312,-1169590,},},
+},
+{
+	{{-18041457,496122,-5780986,-4236308,-25015182,
+	  -9295970,-17033260,-3915457,-24053620,-5380086,},
+	 {-19050024,10299373,8645586,14116315,-28300506,
+	  -14006811,20485934,-235303,-17730502,-16264773,},
+	 {-23827418,-694327,28698296,314052,29067228,
+	  8853509,-19106293,-14965121,32319563,5232406,},},
+	{{20193163,-4993423,-32065399,6101409,-21895507,
+	  10388929,28613076,4580196,-22078503,367037,},
+	 {-7831032,2401913,8778740,3998299,24894890,
+	  -2502142,33166973,-14537720,27429097,-2489712,},
+	 {-3290453,209568,-2823605,-4579747,-9751013,
+	  7631844,-22762582,1096102,1623597,-8761289,},},
+	{{8359041,-8698281,-23818824,-6787028,-26707860,
+	  8280732,-9141091,4656695,9380782,-15783489,},
+	 {-27758692,-5863431,-4312033,14168065,-28722762,
+	  2017020,-12708420,11197482,31787453,-5034156,},
+	 {-26829320,12258687,-30074573,7707952,25032798,
+	  -14575544,2101241,16094410,6114138,-9997225,},},
+	{{21826802,10987061,-14644609,16132545,28238283,
+	  -13118998,-31605462,-3598673,30747197,5191679,},
+	 {30446019,16145479,28985154,1761364,-32128809,
+	  2855924,-15768842,10628695,-25941330,16325485,},
+	 {-31488090,4892169,-29859173,-16628252,20532286,
+	  -627848,20692529,-13767740,-4833287,-9744731,},},
+	{{-19337059,-7513247,12678964,-11571690,30387967,
+	  11356559,28721439,-5962543,23777766,12018318,},
+	 {14095922,-3901237,-32621028,12118387,29195624,
+	  16248886,2913447,-5725525,12958344,-2111354,},
+	 {8297103,11560845,32739651,12858557,-11668572,
+	  -10024298,-1443250,15452914,-23682437,6717776,},},
+	{{-18483327,6924072,-7496353,-9678651,-19510018,
+	  -2400353,2854815,9330734,-29439199,-7554671,},
+	 {-9595856,-12914864,10391241,-987895,5001456,
+	  1294352,-10763651,12071468,-30160380,-12540295,},
+	 {-5093454,6491275,-22118186,-4790593,-9999450,
+	  -4697113,1693547,13680701,-19621893,889132,},},
+	{{10348242,11727201,-18370755,-2529984,-7931990,
+	  -9589124,-17095402,-3669528,-8630708,7469718,},
+	 {32631695,-15304739,11200264,-624329,9221397,
+	  9580462,17696220,-8960947,-1821174,-163613,},
+	 {23877739,16505151,489346,8809968,11526195,
+	  10468423,28930782,9669183,7248265,1395432,},},
+	{{-1988541,2287352,16536695,14303064,-22292445,
+	  15566714,26216711,-12711084,-16167624,-1057026,},
+	 {-17343428,-11294698,18541836,15017232,-17987416,
+	  12396420,-21680506,3114394,-28641771,-7291051,},
+	 {10934562,10613800,-10552044,-6492759,-27037271,
+	  -3204605,18683688,-13898047,-7054405,13018182,},},
+},
+{
+	{{-32270229,-5227088,-17800591,-16238712,25627865,
+	  -1371188,-1115237,13864193,16330830,-3866860,},
+	 {-900095,7143092,11274816,-14263441,27953566,
+	  277727,-9546290,5453393,7988490,4997247,},
+	 {2040260,-2638693,2567406,-8031181,-26372145,
+	  6616984,-21154092,11717208,14019844,8627449,},},
+	{{12978768,2537745,-21725855,13581457,24684164,
+	  -6170057,6804608,8417354,28194334,9458186,},
+	 {-25448535,-11376450,12036089,-2078593,-26620938,
+	  4549979,-9197015,-12124536,9049548,11684372,},
+	 {11757873,338906,-11568320,14766145,-31023753,
+	  -13904081,-4079176,15283969,-25551155,-11580446,},},
+	{{-18426459,11299327,6490632,-6927231,-9250526,
+	  6196577,-6155016,10506696,-25216225,-2872821,},
+	 {15379364,-6427100,16846612,-13856381,-17977811,
+	  16289729,4554709,7087377,2124455,9162811,},
+	 {-1718753,8085112,621749,-14816523,-1313192,
+	  2201041,31409720,-554424,27965183,7852952,},},
+	{{20952777,3348716,30707316,-10237935,19312850,
+	  -9109036,6066965,12683491,-6007501,9554616,},
+	 {-33304193,-12267224,-23266995,16725946,-30866079,
+	  6362219,-12935140,-1112304,-11675829,7235098,},
+	 {-29471402,-10547478,16905614,8660949,11476270,
+	  -10015426,-5793440,-6097356,-7731577,-15771266,},},
+	{{29050967,-4647700,3728190,-11937222,-763567,
+	  -14928810,12276364,336024,-32536443,-2399066,},
+	 {-16891323,16651777,13851883,3922952,-17009030,
+	  3983501,29777256,4090048,17435925,415708,},
+	 {-30512975,-3339182,23976789,5874731,28386954,
+	  -10829484,25729752,6575190,-6985230,5396492,},},
+	{{25466301,-4008635,-23530231,-16491440,9495869,
+	  -145211,22695932,9765593,25703600,11737528,},
+	 {22883193,-12445368,2358557,-1435526,-12427320,
+	  5885011,1625107,-6181443,26154397,-10631727,},
+	 {1045658,15064734,-22133941,-3367504,-12354993,
+	  13513720,-10398553,-9291041,14924673,-4767067,},},
+	{{-29419424,-4786230,-12157271,11819882,-7732184,
+	  5748522,14049659,9460007,-13088310,-6263379,},
+	 {14903916,-16707560,-29926270,9948028,1345009,
+	  16216261,29271615,-7419544,31807684,-7938176,},
+	 {30391025,8514725,-27092912,13312177,28684250,
+	  7865499,96596,-12841599,10344577,10207873,},},
+	{{-27106800,-3000390,26211827,-10259084,24967856,
+	  -8795722,27739846,-4715304,16148361,9176326,},
+	 {26650807,13395949,14424226,10176572,12987172,
+	  -801733,-4423856,-9153673,20499268,-9509887,},
+	 {17786514,12363621,-7324984,9869818,-23410238,
+	  6259474,32427387,-12657683,-1248811,-7075544,},},
+},
+};
+
+#else
+#error "MONOCYPHER_COMB_TABLES must be 1, 2, 4 or 8"
+#endif
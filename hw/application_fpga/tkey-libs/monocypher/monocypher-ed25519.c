@@ -141,8 +141,60 @@ static const u64 K[80] = {
 	0x4cc5d4becb3e42b6,0x597f299cfc657e2a,0x5fcb6fab3ad6faec,0x6c44198c4a475817
 };
 
+#ifdef __riscv
+// The optional SHA-512 core in the TKey. Older hardware traps on
+// access to its address range, so check the version first.
+#include <tkey/tk1_mem.h>
+
+#define SHA512_HW_TK1_VERSION 7
+#define SHA512_HW_NAME0       0x73686135 // "sha5"
+
+typedef uint32_t u32;
+
+static volatile u32 *const sha512_hw_tk1_version = (volatile u32 *)TK1_MMIO_TK1_VERSION;
+static volatile u32 *const sha512_hw_name0       = (volatile u32 *)TK1_MMIO_SHA512_NAME0;
+static volatile u32 *const sha512_hw_ctrl        = (volatile u32 *)TK1_MMIO_SHA512_CTRL;
+static volatile u32 *const sha512_hw_status      = (volatile u32 *)TK1_MMIO_SHA512_STATUS;
+static volatile u32 *const sha512_hw_block       = (volatile u32 *)TK1_MMIO_SHA512_BLOCK_FIRST;
+static volatile u32 *const sha512_hw_h           = (volatile u32 *)TK1_MMIO_SHA512_H_FIRST;
+
+// Compresses the block with the core. Returns 0 without doing
+// anything if there is no core.
+static int sha512_compress_hw(crypto_sha512_ctx *ctx)
+{
+	if (*sha512_hw_tk1_version < SHA512_HW_TK1_VERSION ||
+	    *sha512_hw_name0 != SHA512_HW_NAME0) {
+		return 0;
+	}
+
+	FOR (i, 0, 8) {
+		sha512_hw_h[i*2    ] = (u32)(ctx->hash[i] >> 32);
+		sha512_hw_h[i*2 + 1] = (u32) ctx->hash[i];
+	}
+	FOR (i, 0, 16) {
+		sha512_hw_block[i*2    ] = (u32)(ctx->input[i] >> 32);
+		sha512_hw_block[i*2 + 1] = (u32) ctx->input[i];
+	}
+
+	*sha512_hw_ctrl = 1 << TK1_MMIO_SHA512_CTRL_NEXT_BIT;
+	while ((*sha512_hw_status & (1 << TK1_MMIO_SHA512_STATUS_READY_BIT)) == 0) {
+	}
+
+	FOR (i, 0, 8) {
+		ctx->hash[i] = ((u64)sha512_hw_h[i*2] << 32) | sha512_hw_h[i*2 + 1];
+	}
+	return 1;
+}
+#endif
+
 static void sha512_compress(crypto_sha512_ctx *ctx)
 {
+#ifdef __riscv
+	if (sha512_compress_hw(ctx)) {
+		return;
+	}
+#endif
+
 	u64 a = ctx->hash[0];    u64 b = ctx->hash[1];
 	u64 c = ctx->hash[2];    u64 d = ctx->hash[3];
 	u64 e = ctx->hash[4];    u64 f = ctx->hash[5];
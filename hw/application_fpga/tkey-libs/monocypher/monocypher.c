@@ -1195,6 +1195,54 @@ static void fe_tobytes(u8 s[32], const fe h)
 	WIPE_BUFFER(t);
 }
 
+#ifdef MONOCYPHER_FE25519_TKEY
+// Field multiplication with the FE25519 core in the TKey, selected
+// at compile time. The core gives the same result as fe_mul() and
+// fe_sq() below, which are used if the bitstream doesn't include it.
+// Older hardware traps on access to its address range, so check the
+// version first.
+#include <tkey/tk1_mem.h>
+
+#define FE_HW_TK1_VERSION 7
+#define FE_HW_NAME0       0x66653235 // "fe25"
+
+static volatile u32 *const fe_hw_tk1_version = (volatile u32 *)TK1_MMIO_TK1_VERSION;
+static volatile u32 *const fe_hw_name0       = (volatile u32 *)TK1_MMIO_FE25519_NAME0;
+static volatile u32 *const fe_hw_ctrl        = (volatile u32 *)TK1_MMIO_FE25519_CTRL;
+static volatile u32 *const fe_hw_status      = (volatile u32 *)TK1_MMIO_FE25519_STATUS;
+static volatile u32 *const fe_hw_f           = (volatile u32 *)TK1_MMIO_FE25519_F_FIRST;
+static volatile u32 *const fe_hw_g           = (volatile u32 *)TK1_MMIO_FE25519_G_FIRST;
+static volatile u32 *const fe_hw_h           = (volatile u32 *)TK1_MMIO_FE25519_H_FIRST;
+
+// 0 until checked, then 1 if the core is present, -1 if not.
+static int fe_hw_present;
+
+// h = f * g, or h = f^2 if g is NULL. Returns 0 without doing
+// anything if there is no core.
+static int fe_mul_hw(fe h, const fe f, const fe g)
+{
+	if (fe_hw_present == 0) {
+		fe_hw_present = *fe_hw_tk1_version >= FE_HW_TK1_VERSION &&
+			*fe_hw_name0 == FE_HW_NAME0 ? 1 : -1;
+	}
+	if (fe_hw_present < 0) {
+		return 0;
+	}
+
+	FOR (i, 0, 10) { fe_hw_f[i] = (u32)f[i]; }
+	if (g == 0) {
+		*fe_hw_ctrl = 1 << TK1_MMIO_FE25519_CTRL_SQUARE_BIT;
+	} else {
+		FOR (i, 0, 10) { fe_hw_g[i] = (u32)g[i]; }
+		*fe_hw_ctrl = 1 << TK1_MMIO_FE25519_CTRL_MUL_BIT;
+	}
+	while ((*fe_hw_status & (1 << TK1_MMIO_FE25519_STATUS_READY_BIT)) == 0) {
+	}
+	FOR (i, 0, 10) { h[i] = (i32)fe_hw_h[i]; }
+	return 1;
+}
+#endif
+
 // Precondition
 // -------------
 //   |f0|, |f2|, |f4|, |f6|, |f8|  <  1.65 * 2^26
@@ -1224,6 +1272,12 @@ static void fe_mul_small(fe h, const fe f, i32 g)
 //   |g1|, |g3|, |g5|, |g7|, |g9|  <  1.65 * 2^25
 static void fe_mul(fe h, const fe f, const fe g)
 {
+#ifdef MONOCYPHER_FE25519_TKEY
+	if (fe_mul_hw(h, f, g)) {
+		return;
+	}
+#endif
+
 	// Everything is unrolled and put in temporary variables.
 	// We could roll the loop, but that would make curve25519 twice as slow.
 	i32 f0 = f[0]; i32 f1 = f[1]; i32 f2 = f[2]; i32 f3 = f[3]; i32 f4 = f[4];
@@ -1280,6 +1334,12 @@ static void fe_mul(fe h, const fe f, const fe g)
 // Note: we could use fe_mul() for this, but this is significantly faster
 static void fe_sq(fe h, const fe f)
 {
+#ifdef MONOCYPHER_FE25519_TKEY
+	if (fe_mul_hw(h, f, 0)) {
+		return;
+	}
+#endif
+
 	i32 f0 = f[0]; i32 f1 = f[1]; i32 f2 = f[2]; i32 f3 = f[3]; i32 f4 = f[4];
 	i32 f5 = f[5]; i32 f6 = f[6]; i32 f7 = f[7]; i32 f8 = f[8]; i32 f9 = f[9];
 	i32 f0_2  = f0*2;   i32 f1_2  = f1*2;   i32 f2_2  = f2*2;   i32 f3_2 = f3*2;
@@ -2032,116 +2092,24 @@ int crypto_eddsa_check_equation(const u8 signature[64], const u8 public_key[32],
 	return crypto_verify32(check, zero_point);
 }
 
-// 5-bit signed comb in cached format (Niels coordinates, Z=1)
-static const ge_precomp b_comb_low[8] = {
-	{{-6816601,-2324159,-22559413,124364,18015490,
-	  8373481,19993724,1979872,-18549925,9085059,},
-	 {10306321,403248,14839893,9633706,8463310,
-	  -8354981,-14305673,14668847,26301366,2818560,},
-	 {-22701500,-3210264,-13831292,-2927732,-16326337,
-	  -14016360,12940910,177905,12165515,-2397893,},},
-	{{-12282262,-7022066,9920413,-3064358,-32147467,
-	  2927790,22392436,-14852487,2719975,16402117,},
-	 {-7236961,-4729776,2685954,-6525055,-24242706,
-	  -15940211,-6238521,14082855,10047669,12228189,},
-	 {-30495588,-12893761,-11161261,3539405,-11502464,
-	  16491580,-27286798,-15030530,-7272871,-15934455,},},
-	{{17650926,582297,-860412,-187745,-12072900,
-	  -10683391,-20352381,15557840,-31072141,-5019061,},
-	 {-6283632,-2259834,-4674247,-4598977,-4089240,
-	  12435688,-31278303,1060251,6256175,10480726,},
-	 {-13871026,2026300,-21928428,-2741605,-2406664,
-	  -8034988,7355518,15733500,-23379862,7489131,},},
-	{{6883359,695140,23196907,9644202,-33430614,
-	  11354760,-20134606,6388313,-8263585,-8491918,},
-	 {-7716174,-13605463,-13646110,14757414,-19430591,
-	  -14967316,10359532,-11059670,-21935259,12082603,},
-	 {-11253345,-15943946,10046784,5414629,24840771,
-	  8086951,-6694742,9868723,15842692,-16224787,},},
-	{{9639399,11810955,-24007778,-9320054,3912937,
-	  -9856959,996125,-8727907,-8919186,-14097242,},
-	 {7248867,14468564,25228636,-8795035,14346339,
-	  8224790,6388427,-7181107,6468218,-8720783,},
-	 {15513115,15439095,7342322,-10157390,18005294,
-	  -7265713,2186239,4884640,10826567,7135781,},},
-	{{-14204238,5297536,-5862318,-6004934,28095835,
-	  4236101,-14203318,1958636,-16816875,3837147,},
-	 {-5511166,-13176782,-29588215,12339465,15325758,
-	  -15945770,-8813185,11075932,-19608050,-3776283,},
-	 {11728032,9603156,-4637821,-5304487,-7827751,
-	  2724948,31236191,-16760175,-7268616,14799772,},},
-	{{-28842672,4840636,-12047946,-9101456,-1445464,
-	  381905,-30977094,-16523389,1290540,12798615,},
-	 {27246947,-10320914,14792098,-14518944,5302070,
-	  -8746152,-3403974,-4149637,-27061213,10749585,},
-	 {25572375,-6270368,-15353037,16037944,1146292,
-	  32198,23487090,9585613,24714571,-1418265,},},
-	{{19844825,282124,-17583147,11004019,-32004269,
-	  -2716035,6105106,-1711007,-21010044,14338445,},
-	 {8027505,8191102,-18504907,-12335737,25173494,
-	  -5923905,15446145,7483684,-30440441,10009108,},
-	 {-14134701,-4174411,10246585,-14677495,33553567,
-	  -14012935,23366126,15080531,-7969992,7663473,},},
-};
-
-static const ge_precomp b_comb_high[8] = {
-	{{33055887,-4431773,-521787,6654165,951411,
-	  -6266464,-5158124,6995613,-5397442,-6985227,},
-	 {4014062,6967095,-11977872,3960002,8001989,
-	  5130302,-2154812,-1899602,-31954493,-16173976,},
-	 {16271757,-9212948,23792794,731486,-25808309,
-	  -3546396,6964344,-4767590,10976593,10050757,},},
-	{{2533007,-4288439,-24467768,-12387405,-13450051,
-	  14542280,12876301,13893535,15067764,8594792,},
-	 {20073501,-11623621,3165391,-13119866,13188608,
-	  -11540496,-10751437,-13482671,29588810,2197295,},
-	 {-1084082,11831693,6031797,14062724,14748428,
-	  -8159962,-20721760,11742548,31368706,13161200,},},
-	{{2050412,-6457589,15321215,5273360,25484180,
-	  124590,-18187548,-7097255,-6691621,-14604792,},
-	 {9938196,2162889,-6158074,-1711248,4278932,
-	  -2598531,-22865792,-7168500,-24323168,11746309,},
-	 {-22691768,-14268164,5965485,9383325,20443693,
-	  5854192,28250679,-1381811,-10837134,13717818,},},
-	{{-8495530,16382250,9548884,-4971523,-4491811,
-	  -3902147,6182256,-12832479,26628081,10395408,},
-	 {27329048,-15853735,7715764,8717446,-9215518,
-	  -14633480,28982250,-5668414,4227628,242148,},
-	 {-13279943,-7986904,-7100016,8764468,-27276630,
-	  3096719,29678419,-9141299,3906709,11265498,},},
-	{{11918285,15686328,-17757323,-11217300,-27548967,
-	  4853165,-27168827,6807359,6871949,-1075745,},
-	 {-29002610,13984323,-27111812,-2713442,28107359,
-	  -13266203,6155126,15104658,3538727,-7513788,},
-	 {14103158,11233913,-33165269,9279850,31014152,
-	  4335090,-1827936,4590951,13960841,12787712,},},
-	{{1469134,-16738009,33411928,13942824,8092558,
-	  -8778224,-11165065,1437842,22521552,-2792954,},
-	 {31352705,-4807352,-25327300,3962447,12541566,
-	  -9399651,-27425693,7964818,-23829869,5541287,},
-	 {-25732021,-6864887,23848984,3039395,-9147354,
-	  6022816,-27421653,10590137,25309915,-1584678,},},
-	{{-22951376,5048948,31139401,-190316,-19542447,
-	  -626310,-17486305,-16511925,-18851313,-12985140,},
-	 {-9684890,14681754,30487568,7717771,-10829709,
-	  9630497,30290549,-10531496,-27798994,-13812825,},
-	 {5827835,16097107,-24501327,12094619,7413972,
-	  11447087,28057551,-1793987,-14056981,4359312,},},
-	{{26323183,2342588,-21887793,-1623758,-6062284,
-	  2107090,-28724907,9036464,-19618351,-13055189,},
-	 {-29697200,14829398,-4596333,14220089,-30022969,
-	  2955645,12094100,-13693652,-5941445,7047569,},
-	 {-3201977,14413268,-12058324,-16417589,-9035655,
-	  -7224648,9258160,1399236,30397584,-5684634,},},
-};
+// 4-bit signed combs in cached format (Niels coordinates, Z=1).
+// MONOCYPHER_COMB_TABLES is the number of combs, 1, 2, 4 or 8. More
+// combs means fewer doublings in ge_scalarmult_base() but a larger
+// table, 960 bytes per comb. The tables are generated by
+// tools/gen_comb_tables.py.
+#ifndef MONOCYPHER_COMB_TABLES
+#define MONOCYPHER_COMB_TABLES 2
+#endif
+#define COMB_SPACING (64 / MONOCYPHER_COMB_TABLES)
+#include "monocypher-comb.h"
 
 static void lookup_add(ge *p, ge_precomp *tmp_c, fe tmp_a, fe tmp_b,
                        const ge_precomp comb[8], const u8 scalar[32], int i)
 {
-	u8 teeth = (u8)((scalar_bit(scalar, i)          ) +
-	                (scalar_bit(scalar, i + 32) << 1) +
-	                (scalar_bit(scalar, i + 64) << 2) +
-	                (scalar_bit(scalar, i + 96) << 3));
+	u8 teeth = (u8)((scalar_bit(scalar, i                   )     ) +
+	                (scalar_bit(scalar, i +     COMB_SPACING) << 1) +
+	                (scalar_bit(scalar, i + 2 * COMB_SPACING) << 2) +
+	                (scalar_bit(scalar, i + 3 * COMB_SPACING) << 3));
 	u8 high  = teeth >> 3;
 	u8 index = (teeth ^ (high - 1)) & 7;
 	FOR (j, 0, 8) {
@@ -2159,7 +2127,7 @@ static void lookup_add(ge *p, ge_precomp *tmp_c, fe tmp_a, fe tmp_b,
 // p = [scalar]B, where B is the base point
 static void ge_scalarmult_base(ge *p, const u8 scalar[32])
 {
-	// twin 4-bits signed combs, from Mike Hamburg's
+	// MONOCYPHER_COMB_TABLES 4-bits signed combs, from Mike Hamburg's
 	// Fast and compact elliptic-curve cryptography (2012)
 	// 1 / 2 modulo L
 	static const u8 half_mod_L[32] = {
@@ -2186,13 +2154,17 @@ static void ge_scalarmult_base(ge *p, const u8 scalar[32])
 
 	// Save a double on the first iteration
 	ge_zero(p);
-	lookup_add(p, &tmp_c, tmp_a, tmp_b, b_comb_low , s_scalar, 31);
-	lookup_add(p, &tmp_c, tmp_a, tmp_b, b_comb_high, s_scalar, 31+128);
+	FOR (c, 0, MONOCYPHER_COMB_TABLES) {
+		lookup_add(p, &tmp_c, tmp_a, tmp_b, b_comb[c], s_scalar,
+		           COMB_SPACING - 1 + c * 4 * COMB_SPACING);
+	}
 	// Regular double & add for the rest
-	for (int i = 30; i >= 0; i--) {
+	for (int i = COMB_SPACING - 2; i >= 0; i--) {
 		ge_double(p, p, &tmp_d);
-		lookup_add(p, &tmp_c, tmp_a, tmp_b, b_comb_low , s_scalar, i);
-		lookup_add(p, &tmp_c, tmp_a, tmp_b, b_comb_high, s_scalar, i+128);
+		FOR (c, 0, MONOCYPHER_COMB_TABLES) {
+			lookup_add(p, &tmp_c, tmp_a, tmp_b, b_comb[c], s_scalar,
+			           i + c * 4 * COMB_SPACING);
+		}
 	}
 	// Note: we could save one addition at the end if we assumed the
 	// scalar fit in 252 bits.  Which it does in practice if it is
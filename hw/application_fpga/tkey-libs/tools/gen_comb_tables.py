@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+# SPDX-License-Identifier: BSD-2-Clause
+#
+# Generate the fixed-base comb tables used by ge_scalarmult_base() in
+# Monocypher, for each supported number of combs. Writes a C header
+# to stdout:
+#
+#   ./tools/gen_comb_tables.py > monocypher/monocypher-comb.h
+#
+# Each comb has 4 teeth and 8 entries. With n combs the teeth are
+# 64/n bits apart, and comb c covers bits 128/n*c*2 and up. Entry j
+# of comb c is the point
+#
+#   2^(o+3s) B + sum over t < 3 of (+-1) 2^(o+ts) B
+#
+# where o is the offset of the comb, s the spacing, and the sign of
+# tooth t is given by bit t of j. The points are stored as
+# (y+x, y-x, 2dxy) in Monocypher's field element representation.
+
+import sys
+
+P = 2**255 - 19
+D = -121665 * pow(121666, P - 2, P) % P
+BASE = (
+    15112221349535400772501151409588531511454012693041857206046113283949847762202,
+    46316835694926478169428394003475163141307993866256225615783033603165251855960,
+)
+TEETH = 4
+COMBS = [1, 2, 4, 8]
+
+
+def add(p, q):
+    x1, y1 = p
+    x2, y2 = q
+    t = D * x1 * x2 * y1 * y2 % P
+    x = (x1 * y2 + x2 * y1) * pow(1 + t, P - 2, P) % P
+    y = (y1 * y2 + x1 * x2) * pow(1 - t, P - 2, P) % P
+    return (x, y)
+
+
+def neg(p):
+    return (-p[0] % P, p[1])
+
+
+def mul(k, p):
+    r = (0, 1)
+    while k:
+        if k & 1:
+            r = add(r, p)
+        p = add(p, p)
+        k >>= 1
+    return r
+
+
+def limbs(v):
+    """Field element as ten signed limbs of 26 and 25 bits."""
+    out = []
+    for i in range(10):
+        w = 26 if i % 2 == 0 else 25
+        r = v % (1 << w)
+        if r >= 1 << (w - 1):
+            r -= 1 << w
+        out.append(r)
+        v = (v - r) >> w
+    out[0] += 19 * v
+    return out
+
+
+def fe(v):
+    l = [str(x) for x in limbs(v)]
+    return "{" + ",".join(l[:5]) + ",\n\t  " + ",".join(l[5:]) + ",}"
+
+
+def comb(offset, spacing):
+    entries = []
+    for j in range(2 ** (TEETH - 1)):
+        p = mul(2 ** (offset + (TEETH - 1) * spacing), BASE)
+        for t in range(TEETH - 1):
+            q = mul(2 ** (offset + t * spacing), BASE)
+            p = add(p, q if (j >> t) & 1 else neg(q))
+        x, y = p
+        entries.append(
+            "\t{" + fe((y + x) % P) + ",\n\t " + fe((y - x) % P) + ",\n\t "
+            + fe(2 * D * x * y % P) + ",},"
+        )
+    return "\n".join(entries)
+
+
+def main():
+    out = sys.stdout
+    out.write("// SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>\n")
+    out.write("// SPDX-License-Identifier: BSD-2-Clause\n")
+    out.write("//\n")
+    out.write("// Generated by tools/gen_comb_tables.py. Do not edit.\n")
+    out.write("//\n")
+    out.write("// Fixed-base comb tables for ge_scalarmult_base(), 4-bit\n")
+    out.write("// signed combs in cached format (Niels coordinates, Z=1).\n")
+    out.write("// MONOCYPHER_COMB_TABLES selects the number of combs.\n")
+
+    for n in COMBS:
+        spacing = 256 // (TEETH * n)
+        out.write("\n#%s MONOCYPHER_COMB_TABLES == %d\n" % ("if" if n == COMBS[0] else "elif", n))
+        out.write("static const ge_precomp b_comb[%d][8] = {\n" % n)
+        for c in range(n):
+            out.write("{\n" + comb(c * TEETH * spacing, spacing) + "\n},\n")
+        out.write("};\n")
+
+    out.write("\n#else\n")
+    out.write("#error \"MONOCYPHER_COMB_TABLES must be 1, 2, 4 or 8\"\n")
+    out.write("#endif\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Tillitis AB <tillitis.se>
+# SPDX-License-Identifier: BSD-2-Clause
+
+import argparse
+import struct
+import sys
+
+arg_parser = argparse.ArgumentParser(
+    description=(
+        "Compresses a TKey app binary into the format the firmware"
+        " decompresses while loading: a header and an LZ4 block."
+    )
+)
+
+arg_parser.add_argument("app_bin")
+arg_parser.add_argument("output_bin")
+
+args = arg_parser.parse_args()
+
+# Keep in sync with TK1_APP_MAX_SIZE
+APP_MAX_SIZE = 0x20000
+
+# Two zero bytes (an illegal instruction), "LZ" and the decompressed
+# size, see fw/tk1/lz.h.
+HEADER_MAGIC = b"\x00\x00LZ"
+
+MIN_MATCH = 4
+MAX_OFFSET = 0xFFFF
+
+# The LZ4 block format wants the last match to start at least 12
+# bytes before the end and the last 5 bytes to be literals.
+MF_LIMIT = 12
+LAST_LITERALS = 5
+
+
+def abort(msg: str, exitcode: int):
+    sys.stderr.write(msg + "\n")
+    sys.exit(exitcode)
+
+
+def length_ext(n: int) -> bytes:
+    out = bytearray()
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return bytes(out)
+
+
+def sequence(literals: bytes, offset: int, match_len: int) -> bytes:
+    lit_len = len(literals)
+    out = bytearray()
+
+    token = min(lit_len, 15) << 4
+    if offset:
+        token |= min(match_len - MIN_MATCH, 15)
+    out.append(token)
+
+    if lit_len >= 15:
+        out += length_ext(lit_len - 15)
+    out += literals
+
+    if offset:
+        out += struct.pack("<H", offset)
+        if match_len - MIN_MATCH >= 15:
+            out += length_ext(match_len - MIN_MATCH - 15)
+
+    return bytes(out)
+
+
+def compress(data: bytes) -> bytes:
+    out = bytearray()
+    table = {}
+    anchor = 0
+    pos = 0
+    match_end = len(data) - MF_LIMIT
+
+    while pos < match_end:
+        key = data[pos : pos + MIN_MATCH]
+        cand = table.get(key)
+        table[key] = pos
+
+        if cand is None or pos - cand > MAX_OFFSET:
+            pos += 1
+            continue
+
+        length = MIN_MATCH
+        limit = len(data) - LAST_LITERALS
+        while pos + length < limit and data[cand + length] == data[pos + length]:
+            length += 1
+
+        out += sequence(data[anchor:pos], pos - cand, length)
+
+        for p in range(pos + 1, min(pos + length, match_end)):
+            table[data[p : p + MIN_MATCH]] = p
+
+        pos += length
+        anchor = pos
+
+    out += sequence(data[anchor:], 0, 0)
+
+    return bytes(out)
+
+
+with open(args.app_bin, "rb") as app:
+    app_data = app.read()
+
+if len(app_data) == 0 or len(app_data) > APP_MAX_SIZE:
+    abort("Error: App size must be between 1 and {} bytes".format(APP_MAX_SIZE), -1)
+
+compressed = HEADER_MAGIC + struct.pack("<I", len(app_data)) + compress(app_data)
+
+with open(args.output_bin, "wb") as out:
+    out.write(compressed)
+
+print(
+    "{}: {} -> {} bytes ({:.1f}%)".format(
+        args.app_bin,
+        len(app_data),
+        len(compressed),
+        100.0 * len(compressed) / len(app_data),
+    )
+)
@@ -17,7 +17,18 @@ enum ioend {
 
 enum ch552cmd {
     SET_ENDPOINTS = 0x01, // Config USB endpoints on the CH552
+    SET_BIT_RATE = 0x02,  // Change the UART bit rate to the FPGA
     CH552_CMD_MAX,
 };
 
+enum uart_bit_rate {
+    UART_BIT_RATE_500K = 0x00, // Default
+    UART_BIT_RATE_1M = 0x01,
+    UART_BIT_RATE_MAX,
+};
+
+// Known byte exchanged at a new bit rate before it is kept.
+// Alternating bits make a wrong bit time show as a wrong byte.
+#define UART_BIT_RATE_PROBE 0x55
+
 #endif
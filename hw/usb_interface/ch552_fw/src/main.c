@@ -693,6 +693,10 @@ uint8_t FrameStarted = 0;
 uint8_t FrameDiscard = 0;
 uint8_t DiscardDataAvailable = 0;
 
+/** UART bit rate */
+#define RESET_KEEP_BIT_RATE_1M  0x80  // Set in RESET_KEEP when running at 1 Mbps
+#define BIT_RATE_CONFIRM_MS     50    // Time to wait for the FPGA to confirm a new bit rate
+
 uint8_t increment_pointer(uint8_t pointer, uint8_t increment, uint8_t buffer_size);
 
 void cts_start(void);
@@ -1548,6 +1552,111 @@ inline void check_cts_stop(void)
     }
 }
 
+// SBAUD1 setting for a bit rate, see UART1Setup()
+uint8_t bit_rate_sbaud1(uint8_t rate)
+{
+    if (rate == UART_BIT_RATE_1M) {
+        return 256 - FREQ_SYS / 16 / 1000000;
+    }
+
+    return 256 - FREQ_SYS / 16 / UART1_BAUD;
+}
+
+uint8_t current_bit_rate(void)
+{
+    if (RESET_KEEP & RESET_KEEP_BIT_RATE_1M) {
+        return UART_BIT_RATE_1M;
+    }
+
+    return UART_BIT_RATE_500K;
+}
+
+void send_bit_rate_reply(uint8_t rate)
+{
+    CH554UART1SendByte(IO_CH552);
+    CH554UART1SendByte(2);
+    CH554UART1SendByte(SET_BIT_RATE);
+    CH554UART1SendByte(rate);
+}
+
+// Like send_bit_rate_reply(), but with UART_BIT_RATE_PROBE added, to
+// confirm a new bit rate
+void send_bit_rate_confirm(uint8_t rate)
+{
+    CH554UART1SendByte(IO_CH552);
+    CH554UART1SendByte(3);
+    CH554UART1SendByte(SET_BIT_RATE);
+    CH554UART1SendByte(rate);
+    CH554UART1SendByte(UART_BIT_RATE_PROBE);
+}
+
+// Wait for the FPGA to repeat the SET_BIT_RATE command at the new
+// bit rate, followed by UART_BIT_RATE_PROBE. Returns 1 if it did.
+uint8_t wait_bit_rate_confirm(uint8_t rate)
+{
+    XDATA uint8_t buf[5];
+
+    for (uint8_t ms = 0; ms < BIT_RATE_CONFIRM_MS; ms++) {
+        if (uart_byte_count() >= sizeof(buf)) {
+            circular_copy(buf,
+                          UartRxBuf,
+                          UART_RX_BUF_SIZE,
+                          UartRxBufOutputPointer,
+                          sizeof(buf));
+            UartRxBufOutputPointer = increment_pointer(UartRxBufOutputPointer,
+                                                       sizeof(buf),
+                                                       UART_RX_BUF_SIZE);
+
+            return (buf[0] == IO_CH552) && (buf[1] == 3) &&
+                   (buf[2] == SET_BIT_RATE) && (buf[3] == rate) &&
+                   (buf[4] == UART_BIT_RATE_PROBE);
+        }
+        mDelaymS(1);
+    }
+
+    return 0;
+}
+
+// Negotiate a new UART bit rate with the FPGA:
+//
+// 1. Acknowledge the command at the current bit rate.
+// 2. Switch bit rate and wait for the FPGA to repeat the command
+//    with the known byte UART_BIT_RATE_PROBE.
+// 3. Acknowledge it again at the new bit rate, with the same byte.
+//
+// If the command and the probe byte don't arrive intact in time, go
+// back to the old bit rate. The FPGA does the same when it doesn't
+// get the second acknowledgement intact. An unsupported bit rate is answered with
+// the current one.
+void set_bit_rate(uint8_t rate)
+{
+    uint8_t old_sbaud1 = SBAUD1;
+
+    if (rate >= UART_BIT_RATE_MAX) {
+        send_bit_rate_reply(current_bit_rate());
+        return;
+    }
+
+    send_bit_rate_reply(rate);
+    mDelayuS(2); // Let the last stop bit out before switching
+    SBAUD1 = bit_rate_sbaud1(rate);
+
+    if (!wait_bit_rate_confirm(rate)) {
+        SBAUD1 = old_sbaud1;
+        UartRxBufOutputPointer = UartRxBufInputPointer; // Drop anything received at the wrong bit rate
+        return;
+    }
+
+    send_bit_rate_confirm(rate);
+
+    // Keep the bit rate over the reset done by SET_ENDPOINTS
+    if (rate == UART_BIT_RATE_1M) {
+        RESET_KEEP |= RESET_KEEP_BIT_RATE_1M;
+    } else {
+        RESET_KEEP &= ~RESET_KEEP_BIT_RATE_1M;
+    }
+}
+
 void main(void)
 {
     CfgFsys();     // CH559 clock selection configuration
@@ -1556,11 +1665,12 @@ void main(void)
     mInitSTDIO();  // Serial port 0, can be used for debugging
 #endif
     UART1Setup();  // For communication with FPGA
+    SBAUD1 = bit_rate_sbaud1(current_bit_rate()); // Keep a negotiated bit rate
     UART1Clean();  // Clean register from spurious data
 
     printStrSetup("\nStartup\n");
 
-    uint8_t ActiveEndpoints = RESET_KEEP;
+    uint8_t ActiveEndpoints = RESET_KEEP & ~RESET_KEEP_BIT_RATE_1M;
 
     // Always enable CDC endpoint
     if ((ActiveEndpoints & IO_CDC) == 0x0) {
@@ -1978,13 +2088,17 @@ void main(void)
                     switch (FrameBuf[0]) {
                     case SET_ENDPOINTS:
                         cts_stop(); // Stop UART data from FPGA
-                        RESET_KEEP = FrameBuf[1]; // Save endpoints to persistent register
+                        RESET_KEEP = (FrameBuf[1] & ~RESET_KEEP_BIT_RATE_1M) |
+                                     (RESET_KEEP & RESET_KEEP_BIT_RATE_1M); // Save endpoints to persistent register
                         SAFE_MOD = 0x55; // Start reset sequence
                         SAFE_MOD = 0xAA;
                         GLOBAL_CFG = bSW_RESET;
                         while (1)
                             ;
                         break;
+                    case SET_BIT_RATE:
+                        set_bit_rate(FrameBuf[1]);
+                        break;
                     default:
                         break;
                     } // END switch(FrameBuf[0])